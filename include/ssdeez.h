@@ -67,6 +67,21 @@ extern "C" {
 /* Specifies the standard deviation ratio for the erase latency. */
 #define DZ_BLOCK_ERASE_LATENCY_STDDEV_RATIO    0.05
 
+/* The maximum number of planes in a NAND flash die. */
+#define DZ_DIE_MAX_PLANE_COUNT                 64U
+
+/* The "FAIL" bit of the status register (program or erase failed). */
+#define DZ_DIE_STATUS_FAIL                     0x01U
+
+/* The "ARDY" bit of the status register (array ready). */
+#define DZ_DIE_STATUS_ARDY                     0x20U
+
+/* The "RDY" bit of the status register (ready for another command). */
+#define DZ_DIE_STATUS_RDY                      0x40U
+
+/* The "WP#" bit of the status register (not write-protected). */
+#define DZ_DIE_STATUS_WP_N                     0x80U
+
 /*
     Specifies how much space the OOB (Out-Of-Band) area takes up,
     in relation to the total page size.
@@ -99,6 +114,7 @@ typedef unsigned char dzByte;
 typedef ptrdiff_t     dzISize;
 typedef size_t        dzUSize;
 
+typedef int8_t        dzI8;
 typedef int32_t       dzI32;
 typedef int64_t       dzI64;
 
@@ -118,14 +134,18 @@ typedef enum dzResult_ {
     DZ_RESULT_OK = 0,
     DZ_RESULT_ALREADY_FREE,
     DZ_RESULT_ALREADY_VALID,
+    DZ_RESULT_BUSY,
     DZ_RESULT_INJECTION_FAILED,
     DZ_RESULT_INTERNAL_ERROR,
     DZ_RESULT_INVALID_ARGUMENT,
+    DZ_RESULT_INVALID_IMAGE,
     DZ_RESULT_INVALID_METADATA,
     DZ_RESULT_INVALID_SEQUENCE,
     DZ_RESULT_INVALID_STATE,
+    DZ_RESULT_IO_ERROR,
     DZ_RESULT_MAP_UPDATE_FAILED,
     DZ_RESULT_NO_MEMORY,
+    DZ_RESULT_NO_SPACE,
     DZ_RESULT_COUNT_
 } dzResult;
 
@@ -135,7 +155,7 @@ typedef enum dzResult_ {
 typedef enum dzBlockState_ {
     DZ_BLOCK_STATE_UNKNOWN = -1,
     DZ_BLOCK_STATE_FREE,
-    // DZ_BLOCK_STATE_VICTIM,
+    DZ_BLOCK_STATE_VICTIM,
     DZ_BLOCK_STATE_ACTIVE,
     DZ_BLOCK_STATE_BAD,
     DZ_BLOCK_STATE_RESERVED,
@@ -146,7 +166,7 @@ typedef enum dzBlockState_ {
 typedef enum dzPageState_ {
     DZ_PAGE_STATE_UNKNOWN = -1,
     DZ_PAGE_STATE_FREE,
-    // DZ_PAGE_STATE_INVALID,
+    DZ_PAGE_STATE_INVALID,
     DZ_PAGE_STATE_VALID,
     DZ_PAGE_STATE_BAD,
     DZ_PAGE_STATE_RESERVED,
@@ -163,11 +183,31 @@ typedef enum dzCellType_ {
     DZ_CELL_TYPE_COUNT_
 } dzCellType;
 
+/* An enumeration that represents how a NAND flash die retains page data. */
+typedef enum dzDieDataMode_ {
+    DZ_DIE_DATA_MODE_UNKNOWN = -1,
+    DZ_DIE_DATA_MODE_FULL,         // Page data
+    DZ_DIE_DATA_MODE_FINGERPRINT,  // 64-bit fingerprints of page data
+    DZ_DIE_DATA_MODE_NONE,         // Page metadata only
+    DZ_DIE_DATA_MODE_COUNT_
+} dzDieDataMode;
+
+/* An enumeration that represents the type of a simulated operation. */
+typedef enum dzSimOpType_ {
+    DZ_SIM_OP_TYPE_UNKNOWN = -1,
+    DZ_SIM_OP_TYPE_PROGRAM,
+    DZ_SIM_OP_TYPE_READ,
+    DZ_SIM_OP_TYPE_ERASE,
+    DZ_SIM_OP_TYPE_CACHE_PROGRAM,
+    DZ_SIM_OP_TYPE_CACHE_READ,
+    DZ_SIM_OP_TYPE_COUNT_
+} dzSimOpType;
+
 /* ========================================================================> */
 
 /* A structure that represents a physical page address. */
 typedef struct dzPPA_ {
-    // dzU64 channelId;
+    dzU64 channelId;
     dzU64 chipId;
     dzU64 dieId;
     dzU64 planeId;
@@ -180,15 +220,13 @@ typedef dzPPA dzPBA;
 
 /* ========================================================================> */
 
-/* A structure that represents the configuration of a NAND flash page. */
+/* A structure that represents the configuration of NAND flash pages. */
 typedef struct dzPageConfig_ {
-    dzPPA physicalPageAddress;
-    dzF64 endurancePenalty;
-    dzU32 pageSizeInBytes;
+    dzU64 pageCount;
     dzCellType cellType;
 } dzPageConfig;
 
-/* A structure that represents the metadata of a NAND flash page. */
+/* A structure that represents the metadata of NAND flash pages. */
 typedef struct dzPageMetadata_ dzPageMetadata;
 
 /* ========================================================================> */
@@ -230,11 +268,21 @@ typedef struct dzDieConfig_ {
     dzU32 blockCountPerPlane;
     dzU32 pageCountPerBlock;
     dzU32 pageSizeInBytes;
+    dzU32 ioCycleTime;  // in nanoseconds per byte (`0` for instant I/O)
+    dzDieDataMode dataMode;
+    dzU64 seed;
 } dzDieConfig;
 
 /* A structure that represents the metadata of a NAND flash die. */
 typedef struct dzDieMetadata_ dzDieMetadata;
 
+/* A structure that represents a read-only view of the data of a page. */
+typedef struct dzDiePageView_ {
+    const dzByte *ptr;  // `NULL` in 'dataless' modes
+    dzUSize size;
+    dzU64 generation;  // Invalidated on erase
+} dzDiePageView;
+
 /* A structure that represents various statistics of a NAND flash die. */
 typedef struct dzDieStatistics_ dzDieStatistics;
 
@@ -247,12 +295,39 @@ typedef struct dzChip_ dzChip;
 typedef struct dzChipConfig_ {
     dzDieConfig *dieConfig;
     dzU64 chipId;
+    dzU64 seed;
     dzU32 dieCount;
+    dzU32 threadCount;  // `0` for the number of online processors
     // TODO: ...
 } dzChipConfig;
 
 /* ========================================================================> */
 
+/* A structure that represents a channel (shared bus) of NAND flash chips. */
+typedef struct dzChannel_ dzChannel;
+
+/* A structure that represents the configuration of a channel. */
+typedef struct dzChannelConfig_ {
+    dzChipConfig *chipConfig;
+    dzU64 channelId;
+    dzU32 chipCount;
+    dzU32 timingMode;  // ONFI timing mode of the bus (`0` to `5`)
+} dzChannelConfig;
+
+/* ========================================================================> */
+
+/* A structure that represents a solid-state drive. */
+typedef struct dzSSD_ dzSSD;
+
+/* A structure that represents the configuration of a solid-state drive. */
+typedef struct dzSSDConfig_ {
+    dzChannelConfig *channelConfig;
+    dzU32 channelCount;
+    // TODO: ...
+} dzSSDConfig;
+
+/* ========================================================================> */
+
 /* A structure that represents a byte array. */
 typedef struct dzByteArray_ {
     dzByte *ptr;
@@ -266,8 +341,105 @@ typedef struct dzByteStream_ {
     dzUSize offset;
 } dzByteStream;
 
+/* A structure that represents a pseudo-random number generator. */
+typedef struct dzRng_ {
+    dzU64 states[4];
+} dzRng;
+
+/* ========================================================================> */
+
+/* A structure that represents a discrete-event simulator. */
+typedef struct dzSim_ dzSim;
+
+/* 
+    A structure that represents the configuration of a simulator, 
+    in which reads can suspend program and erase operations 
+    (but not cache program operations).
+*/
+typedef struct dzSimConfig_ {
+    dzU64 eventCapacity;    // `0` for the default capacity
+    dzU64 suspendOverhead;  // in nanoseconds, per suspension
+    dzU32 maxSuspendCount;  // per operation (`0` to never suspend)
+} dzSimConfig;
+
+/* A function pointer type that represents the callback of an event. */
+typedef void (*dzSimEventCallback)(dzSim *sim, void *ctx);
+
+/* 
+    A function pointer type that is called on a single thread whenever 
+    all simulators in a parallel run have reached `time`.
+*/
+typedef void (*dzSimSyncCallback)(dzSim **sims,
+                                  dzU32 simCount,
+                                  dzU64 time,
+                                  void *ctx);
+
+/* A structure that represents the configuration of a parallel run. */
+typedef struct dzSimParallelConfig_ {
+    dzU64 lookahead;    // in nanoseconds
+    dzU32 threadCount;  // `0` for the number of online processors
+    dzSimSyncCallback onSync;
+    void *ctx;
+} dzSimParallelConfig;
+
+/* A structure that represents a simulated operation on a NAND flash die. */
+typedef struct dzSimOp_ dzSimOp;
+
+/* A function pointer type that is called when an operation completes. */
+typedef void (*dzSimOpCallback)(dzSim *sim, dzSimOp *op);
+
+/* A structure that represents a simulated operation on a NAND flash die. */
+struct dzSimOp_ {
+    dzSimOpType type;
+    dzDie *die;
+    dzChannel *channel;  // `NULL` for a dedicated bus
+    dzPPA ppa;           // Only the block address is used by erase operations
+    dzByteArray buffer;
+    const dzPPA *ppas;           // Multi-plane operations only
+    const dzByteArray *buffers;  // Multi-plane operations only
+    dzU64 ppaCount;              // `0` for single-plane operations
+
+    // NOTE: Reserved while the operation is submitted through a `dzQueue`
+    dzSimOpCallback onComplete;
+    void *ctx;
+
+    dzResult result;
+    dzU64 issueTime;     // in nanoseconds
+    dzU64 startTime;     // in nanoseconds
+    dzU64 endTime;       // in nanoseconds
+    dzU32 suspendCount;  // Program and erase operations only
+    dzU64 eventIndex;    // Reserved for the simulator
+};
+
+/* ========================================================================> */
+
+/* 
+    A structure that represents a pair of lock-free submission and 
+    completion queues, shared by a host thread and a simulator thread.
+*/
+typedef struct dzQueue_ dzQueue;
+
+/* A structure that represents the configuration of a queue pair. */
+typedef struct dzQueueConfig_ {
+    dzU32 depth;  // Number of entries in each queue (a power of two)
+} dzQueueConfig;
+
+/* ========================================================================> */
+
+/* A structure that represents a page-mapped flash translation layer. */
+typedef struct dzFTL_ dzFTL;
+
+/* A structure that represents the configuration of an FTL. */
+typedef struct dzFTLConfig_ {
+    dzU64 logicalPageCount;    // `0` for the largest possible count
+    dzU32 reservedBlockCount;  // Free blocks per die kept for GC (`0` for `1`)
+} dzFTLConfig;
+
 /* Constants ==============================================================> */
 
+/* A constant that represents an invalid channel identifier. */
+extern const dzU64 DZ_CHANNEL_INVALID_ID;
+
 /* A constant that represents an invalid chip identifier. */
 extern const dzU64 DZ_CHIP_INVALID_ID;
 
@@ -287,11 +459,19 @@ extern const dzU64 DZ_PAGE_INVALID_ID;
 
 /* <---------------------------------------------------------- [src/block.c] */
 
-/* Initializes a block `metadata` within the given region. */
-dzResult dzBlockInitMetadata(dzBlockMetadata *metadata, dzBlockConfig config);
+/* 
+    Initializes a block `metadata` within the given region, 
+    placing its page state maps in `mapRegion`.
+*/
+dzResult dzBlockInitMetadata(dzBlockMetadata *metadata,
+                             dzByte *mapRegion,
+                             dzBlockConfig config);
 
-/* De-initializes the block `metadata`. */
-void dzBlockDeinitMetadata(dzBlockMetadata *metadata);
+/* 
+    Returns the size of the page state maps 
+    of a block with `pageCount` pages.
+*/
+dzUSize dzBlockGetMapRegionSize(dzU64 pageCount);
 
 /* Returns the size of `dzBlockMetadata`. */
 dzUSize dzBlockGetMetadataSize(void);
@@ -302,6 +482,14 @@ dzUSize dzBlockGetMetadataSize(void);
 dzResult dzBlockGetMaxEraseLatency(const dzBlockMetadata *metadata,
                                    dzF64 *tBERS);
 
+/* 
+    Returns the identifier of the first page in `pageState` 
+    at or after `pageId` within a block.
+*/
+dzU64 dzBlockFindNextPageId(const dzBlockMetadata *metadata,
+                            dzPageState pageState,
+                            dzU64 pageId);
+
 /* Returns the next page identifier of a block. */
 dzU64 dzBlockGetNextPageId(dzBlockMetadata *metadata);
 
@@ -314,6 +502,17 @@ dzBlockState dzBlockGetState(const dzBlockMetadata *metadata);
 /* Returns the total number of 'erase' operations performed on a block. */
 dzU64 dzBlockGetTotalEraseCount(const dzBlockMetadata *metadata);
 
+/* Returns the number of pages in `pageState` within a block. */
+dzU64 dzBlockGetPageCountByState(const dzBlockMetadata *metadata,
+                                 dzPageState pageState);
+
+/* Returns the state of the `pageId`-th page within a block. */
+dzPageState dzBlockGetPageState(const dzBlockMetadata *metadata,
+                                dzU64 pageId);
+
+/* Returns the number of invalid pages in a block. */
+dzU64 dzBlockGetInvalidPageCount(const dzBlockMetadata *metadata);
+
 /* Returns the number of valid pages in a block. */
 dzU64 dzBlockGetValidPageCount(const dzBlockMetadata *metadata);
 
@@ -329,7 +528,9 @@ dzResult dzBlockMarkAsActive(dzBlockMetadata *metadata);
 dzResult dzBlockMarkAsBad(dzBlockMetadata *metadata);
 
 /* Marks a block as free. */
-dzResult dzBlockMarkAsFree(dzBlockMetadata *metadata, dzF64 *tBERS);
+dzResult dzBlockMarkAsFree(dzBlockMetadata *metadata,
+                           dzRng *rng,
+                           dzF64 *tBERS);
 
 /* Marks a block as reserved. */
 dzResult dzBlockMarkAsReserved(dzBlockMetadata *metadata);
@@ -337,12 +538,77 @@ dzResult dzBlockMarkAsReserved(dzBlockMetadata *metadata);
 /* Marks a block as unknown. */
 dzResult dzBlockMarkAsUnknown(dzBlockMetadata *metadata);
 
+/* Marks a block as a victim for garbage collection. */
+dzResult dzBlockMarkAsVictim(dzBlockMetadata *metadata);
+
 /* ========================================================================> */
 
+/* Marks the valid `pageId`-th page as invalid within a block. */
+dzResult dzBlockInvalidatePage(dzBlockMetadata *metadata, dzU64 pageId);
+
 /* Updates the state of the given page within a block's page state map. */
 dzResult dzBlockUpdatePageStateMap(dzBlockMetadata *metadata,
                                    dzPageState pageState);
 
+/* ========================================================================> */
+
+/* Returns the size of the state of a block with `pageCount` pages. */
+dzUSize dzBlockGetStateSize(dzU64 pageCount);
+
+/* Reads the state of a block from `src`. */
+dzResult dzBlockReadState(dzBlockMetadata *metadata, dzByteStream *src);
+
+/* Writes the state of a block to `dst`. */
+dzResult dzBlockWriteState(const dzBlockMetadata *metadata,
+                           dzByteStream *dst);
+
+/* <-------------------------------------------------------- [src/channel.c] */
+
+/* Initializes `*channel` with the given `config`. */
+dzResult dzChannelInit(dzChannel **channel, dzChannelConfig config);
+
+/* Releases the memory allocated for `channel`. */
+void dzChannelDeinit(dzChannel *channel);
+
+/* ========================================================================> */
+
+/* Returns the bandwidth of the bus of `channel`, in bytes per nanosecond. */
+dzF64 dzChannelGetBandwidth(const dzChannel *channel);
+
+/* Returns the `chipId`-th chip in `channel`. */
+dzChip *dzChannelGetChip(const dzChannel *channel, dzU64 chipId);
+
+/* Returns the number of chips in `channel`. */
+dzU32 dzChannelGetChipCount(const dzChannel *channel);
+
+/* ========================================================================> */
+
+/* 
+    Returns the total time that the bus of `channel` has been busy, 
+    in nanoseconds.
+*/
+dzU64 dzChannelGetBusBusyTime(const dzChannel *channel);
+
+/* 
+    Returns the time at which the bus of `channel` becomes free, 
+    in nanoseconds.
+*/
+dzU64 dzChannelGetBusReadyTime(const dzChannel *channel);
+
+/* 
+    Returns the fraction of the time until `time` during which 
+    the bus of `channel` has been busy.
+*/
+dzF64 dzChannelGetBusUtilization(const dzChannel *channel, dzU64 time);
+
+/* 
+    Marks the bus of `channel` as busy for `duration` nanoseconds 
+    from `startTime`, if it is free at `startTime`.
+*/
+dzResult dzChannelMarkBusAsBusy(dzChannel *channel,
+                                dzU64 startTime,
+                                dzU64 duration);
+
 /* <----------------------------------------------------------- [src/chip.c] */
 
 /* Initializes `*chip` with the given `config`. */
@@ -351,9 +617,28 @@ dzResult dzChipInit(dzChip **chip, dzChipConfig config);
 /* Releases the memory allocated for `chip`. */
 void dzChipDeinit(dzChip *chip);
 
+/* Initializes `*chip` from the snapshot file at `path`. */
+dzResult dzChipLoad(dzChip **chip, const char *path);
+
+/* 
+    Writes a snapshot of `chip` to the file at `path`, 
+    including the page data if `withPayload` is `true`.
+*/
+dzResult dzChipSave(const dzChip *chip, const char *path, dzBool withPayload);
+
 /* ========================================================================> */
 
-// TODO: ...
+/* Returns the `dieId`-th die in `chip`. */
+dzDie *dzChipGetDie(const dzChip *chip, dzU64 dieId);
+
+/* Returns the number of dies in `chip`. */
+dzU32 dzChipGetDieCount(const dzChip *chip);
+
+/* 
+    Returns `true` if all dies in `chip` are ready at `time`, 
+    i.e. the shared R/B# signal is high.
+*/
+dzBool dzChipIsReady(const dzChip *chip, dzU64 time);
 
 /* <------------------------------------------------------------ [src/die.c] */
 
@@ -363,6 +648,30 @@ dzResult dzDieInit(dzDie **die, dzDieConfig config);
 /* Releases the memory allocated for `die`. */
 void dzDieDeinit(dzDie *die);
 
+/* 
+    Initializes `*die` with the given `config`, 
+    backed by a new image file at `path`.
+*/
+dzResult dzDieCreateImage(dzDie **die, dzDieConfig config, const char *path);
+
+/* Initializes `*die` from the existing image file at `path`. */
+dzResult dzDieOpenImage(dzDie **die, const char *path);
+
+/* 
+    Initializes `*die` as a copy-on-write clone of `parent`, 
+    sharing the page data of `parent` until either of them modifies it.
+*/
+dzResult dzDieClone(dzDie **die, const dzDie *parent);
+
+/* Initializes `*die` from the snapshot read from `stream`. */
+dzResult dzDieLoad(dzDie **die, FILE *stream);
+
+/* 
+    Writes a snapshot of `die` to `stream`, 
+    including the page data if `withPayload` is `true`.
+*/
+dzResult dzDieSave(const dzDie *die, FILE *stream, dzBool withPayload);
+
 /* Returns the configuration of `die`. */
 dzDieConfig dzDieGetConfig(const dzDie *die);
 
@@ -396,6 +705,12 @@ dzPPA dzDieGetNextPPA(const dzDie *die, dzPPA ppa);
 
 /* ========================================================================> */
 
+/* 
+    Returns the latency of the last program, read or erase operation 
+    on `die`, in milliseconds.
+*/
+dzF64 dzDieGetLastLatency(const dzDie *die);
+
 /* Returns the maximum P/E cycles among all pages within `die`. */
 dzU32 dzDieGetMaxPeCycles(const dzDie *die);
 
@@ -405,15 +720,44 @@ dzF64 dzDieGetMaxProgramLatency(const dzDie *die);
 /* Returns the maximum read latency of `die`, in milliseconds. */
 dzF64 dzDieGetMaxReadLatency(const dzDie *die);
 
+/* 
+    Returns the number of invalid pages in the block 
+    corresponding to `pba` within `die`.
+*/
+dzU64 dzDieGetBlockInvalidPageCount(const dzDie *die, dzPBA pba);
+
+/* 
+    Returns the number of valid pages in the block 
+    corresponding to `pba` within `die`.
+*/
+dzU64 dzDieGetBlockValidPageCount(const dzDie *die, dzPBA pba);
+
+/* Returns the number of invalid pages in `die`. */
+dzU64 dzDieGetInvalidPageCount(const dzDie *die);
+
 /* Returns the total number of pages in `die`. */
 dzU64 dzDieGetPageCount(const dzDie *die);
 
+/* 
+    Returns the fingerprint of the data of the page 
+    corresponding to `ppa` within `die`. 
+*/
+dzResult dzDieGetPageFingerprint(const dzDie *die,
+                                 dzPPA ppa,
+                                 dzU64 *fingerprint);
+
 /* 
     Returns the current state of the page 
     corresponding to `ppa` within `die`. 
 */
 dzPageState dzDieGetPageState(const dzDie *die, dzPPA ppa);
 
+/* Returns the number of pages whose data are resident in `die`. */
+dzU64 dzDieGetResidentPageCount(const dzDie *die);
+
+/* Returns the number of valid pages in `die`. */
+dzU64 dzDieGetValidPageCount(const dzDie *die);
+
 /* ========================================================================> */
 
 /* Returns the total number of 'program' operations performed on `die`. */
@@ -427,15 +771,164 @@ dzU64 dzDieGetTotalEraseCount(const dzDie *die);
 
 /* ========================================================================> */
 
+/* 
+    Returns the program or erase operation in progress on the array 
+    of `die`, or `NULL` if there is none.
+*/
+dzSimOp *dzDieGetActiveOp(const dzDie *die);
+
+/* Returns the total time that `die` has been busy, in nanoseconds. */
+dzU64 dzDieGetBusyTime(const dzDie *die);
+
+/* 
+    Returns the time at which the cache register of `die` becomes free, 
+    in nanoseconds.
+*/
+dzU64 dzDieGetCacheReadyTime(const dzDie *die);
+
+/* 
+    Returns the time it takes to transfer a page between the host 
+    and the cache register of `die`, in nanoseconds.
+*/
+dzU64 dzDieGetPageTransferTime(const dzDie *die);
+
+/* 
+    Returns the total time that the `planeId`-th plane 
+    in `die` has been busy, in nanoseconds.
+*/
+dzU64 dzDieGetPlaneBusyTime(const dzDie *die, dzU64 planeId);
+
+/* 
+    Returns the time at which the `planeId`-th plane 
+    in `die` becomes ready, in nanoseconds.
+*/
+dzU64 dzDieGetPlaneReadyTime(const dzDie *die, dzU64 planeId);
+
+/* 
+    Returns the fraction of the time until `time` during which 
+    the `planeId`-th plane in `die` has been busy.
+*/
+dzF64 dzDieGetPlaneUtilization(const dzDie *die, dzU64 planeId, dzU64 time);
+
+/* 
+    Returns the time at which the array of `die` becomes ready, 
+    in nanoseconds.
+*/
+dzU64 dzDieGetReadyTime(const dzDie *die);
+
+/* 
+    Returns the time at which the operation suspended in `die` 
+    is resumed, in nanoseconds.
+*/
+dzU64 dzDieGetResumeTime(const dzDie *die);
+
+/* 
+    Returns the fraction of the time until `time` during which 
+    `die` has been busy.
+*/
+dzF64 dzDieGetUtilization(const dzDie *die, dzU64 time);
+
+/* Returns `true` if `die` is ready (R/B# is high) at `time`. */
+dzBool dzDieIsReady(const dzDie *die, dzU64 time);
+
+/* 
+    Marks the planes in `planeMask` of `die` as busy for `duration` 
+    nanoseconds from `startTime`, if the array is ready at `startTime`.
+*/
+dzResult dzDieMarkAsBusy(dzDie *die,
+                         dzU64 planeMask,
+                         dzU64 startTime,
+                         dzU64 duration);
+
+/* 
+    Marks the cache register of `die` as busy for `duration` nanoseconds 
+    from `startTime`, if it is free at `startTime`.
+*/
+dzResult dzDieMarkCacheAsBusy(dzDie *die, dzU64 startTime, dzU64 duration);
+
+/* Returns the contents of the status register of `die` at `time`. */
+dzByte dzDieReadStatus(const dzDie *die, dzU64 time);
+
+/* 
+    Sets `op` as the program or erase operation in progress on the array 
+    of `die`, or clears it if `op` is `NULL`.
+*/
+void dzDieSetActiveOp(dzDie *die, dzSimOp *op);
+
+/* 
+    Suspends the array operation of `die` in progress at `time` 
+    for `duration` nanoseconds, during which the planes in `planeMask` 
+    are busy with another operation.
+*/
+dzResult dzDieSuspend(dzDie *die,
+                      dzU64 planeMask,
+                      dzU64 time,
+                      dzU64 duration);
+
+/* ========================================================================> */
+
 /* Writes `src.ptr` to the page corresponding to `ppa` in `die`. */
 dzResult dzDieProgramPage(dzDie *die, dzPPA ppa, dzByteArray src);
 
+/* 
+    Writes `srcs[i].ptr` to the page corresponding to `ppas[i]` in `die`, 
+    for each of the `count` pages in order, and stores the result of 
+    each write in `results[i]`.
+*/
+dzResult dzDieProgramPages(dzDie *die,
+                           const dzPPA *ppas,
+                           const dzByteArray *srcs,
+                           dzResult *results,
+                           dzU64 count);
+
+/* 
+    Writes `srcs[i].ptr` to the page corresponding to `ppas[i]` in `die`, 
+    for each of the `count` planes at once (multi-plane program).
+*/
+dzResult dzDieProgramMultiPlane(dzDie *die,
+                                const dzPPA *ppas,
+                                const dzByteArray *srcs,
+                                dzU64 count);
+
 /* 
     Reads data from the page corresponding to `ppa` in `die`, 
     and copies it to `dst.ptr`. 
 */
 dzResult dzDieReadPage(dzDie *die, dzPPA ppa, dzByteArray dst);
 
+/* 
+    Reads data from the page corresponding to `ppas[i]` in `die`, 
+    and copies it to `dsts[i].ptr`, for each of the `count` pages 
+    in order, and stores the result of each read in `results[i]`.
+*/
+dzResult dzDieReadPages(dzDie *die,
+                        const dzPPA *ppas,
+                        const dzByteArray *dsts,
+                        dzResult *results,
+                        dzU64 count);
+
+/* 
+    Reads the page corresponding to `ppa` in `die` without copying 
+    its data, and stores a read-only view of the data in `view`.
+*/
+dzResult dzDieReadPageView(dzDie *die, dzPPA ppa, dzDiePageView *view);
+
+/* 
+    Returns `true` if `view` still points to the data of its page in `die`, 
+    i.e. no block in `die` has been erased since `view` was created.
+*/
+dzBool dzDieIsPageViewValid(const dzDie *die, dzDiePageView view);
+
+/* 
+    Reads data from the page corresponding to `ppas[i]` in `die`, 
+    and copies it to `dsts[i].ptr`, for each of the `count` planes 
+    at once (multi-plane read).
+*/
+dzResult dzDieReadMultiPlane(dzDie *die,
+                             const dzPPA *ppas,
+                             const dzByteArray *dsts,
+                             dzU64 count);
+
 /* 
     Reads data from the ONFI parameter page of `die`, 
     and copies it to `dst.ptr`.
@@ -445,6 +938,82 @@ dzResult dzDieReadParameterPage(dzDie *die, dzByteArray dst);
 /* Erases the block corresponding to `pba` in `die`. */
 dzResult dzDieEraseBlock(dzDie *die, dzPBA pba);
 
+/* 
+    Erases the block corresponding to `pbas[i]` in `die`, for each of 
+    the `count` blocks in order, and stores the result of each erase 
+    in `results[i]`.
+*/
+dzResult dzDieEraseBlocks(dzDie *die,
+                          const dzPBA *pbas,
+                          dzResult *results,
+                          dzU64 count);
+
+/* 
+    Erases the block corresponding to `pbas[i]` in `die`, 
+    for each of the `count` planes at once (multi-plane erase).
+*/
+dzResult dzDieEraseMultiPlane(dzDie *die, const dzPBA *pbas, dzU64 count);
+
+/* 
+    Marks the page corresponding to `ppa` in `die` as invalid, 
+    e.g. when its data have been overwritten or trimmed.
+*/
+dzResult dzDieInvalidatePage(dzDie *die, dzPPA ppa);
+
+/* 
+    Marks the block corresponding to `pba` in `die` 
+    as a victim for garbage collection.
+*/
+dzResult dzDieMarkBlockAsVictim(dzDie *die, dzPBA pba);
+
+/* <------------------------------------------------------------ [src/ftl.c] */
+
+/* Initializes `*ftl` on top of `ssd` with the given `config`. */
+dzResult dzFTLInit(dzFTL **ftl, dzSSD *ssd, dzFTLConfig config);
+
+/* Releases the memory allocated for `ftl`. */
+void dzFTLDeinit(dzFTL *ftl);
+
+/* ========================================================================> */
+
+/* Returns the number of logical pages in `ftl`. */
+dzU64 dzFTLGetLogicalPageCount(const dzFTL *ftl);
+
+/* Returns the number of logical pages mapped to physical pages in `ftl`. */
+dzU64 dzFTLGetMappedPageCount(const dzFTL *ftl);
+
+/* 
+    Returns the physical page address that the `lpn`-th logical page 
+    in `ftl` is mapped to, or an invalid address if it is not mapped.
+*/
+dzPPA dzFTLGetPPA(const dzFTL *ftl, dzU64 lpn);
+
+/* 
+    Returns the ratio of pages programmed by `ftl` (including garbage 
+    collection) to pages written by the host, or `0.0` if there are none.
+*/
+dzF64 dzFTLGetWriteAmplification(const dzFTL *ftl);
+
+/* ========================================================================> */
+
+/* 
+    Writes `src.ptr` to a free physical page in `ftl`, and maps 
+    the `lpn`-th logical page to it (out-of-place write).
+*/
+dzResult dzFTLWritePage(dzFTL *ftl, dzU64 lpn, dzByteArray src);
+
+/* 
+    Reads data from the physical page that the `lpn`-th logical page 
+    in `ftl` is mapped to, and copies it to `dst.ptr`.
+*/
+dzResult dzFTLReadPage(dzFTL *ftl, dzU64 lpn, dzByteArray dst);
+
+/* 
+    Unmaps the `lpn`-th logical page in `ftl`, so that its physical page 
+    can be reclaimed by garbage collection.
+*/
+dzResult dzFTLTrimPage(dzFTL *ftl, dzU64 lpn);
+
 /* <----------------------------------------------------------- [src/onfi.c] */
 
 /* 
@@ -453,98 +1022,362 @@ dzResult dzDieEraseBlock(dzDie *die, dzPBA pba);
 */
 dzResult dzOnfiCreateParameterPage(const dzDie *die, dzByteArray dst);
 
+/* 
+    Returns the read/write cycle time of the ONFI `timingMode`, 
+    in nanoseconds, or `0` if `timingMode` is not valid.
+*/
+dzU32 dzOnfiGetCycleTime(dzU32 timingMode);
+
 // TODO: ...
 
 /* <----------------------------------------------------------- [src/page.c] */
 
-/* Initializes a page metadata within the given `pagePtr`. */
-dzResult dzPageInitMetadata(dzByte *pagePtr, dzPageConfig config);
+/* 
+    Initializes a page `metadata` within the given region, 
+    placing its per-page arrays in `arrayRegion` and drawing 
+    the endurance of each page from `rng`.
+*/
+dzResult dzPageInitMetadata(dzPageMetadata *metadata,
+                            dzByte *arrayRegion,
+                            dzPageConfig config,
+                            dzRng *rng);
+
+/* 
+    Initializes a page `metadata` within the given region, 
+    reusing the per-page arrays already stored in `arrayRegion`.
+*/
+dzResult dzPageLoadMetadata(dzPageMetadata *metadata,
+                            dzByte *arrayRegion,
+                            dzPageConfig config);
+
+/* Returns the maximum P/E cycles of the `pageIndex`-th page. */
+dzU32 dzPageGetMaxPeCycles(const dzPageMetadata *metadata, dzU64 pageIndex);
 
-/* Returns the maximum P/E cycles of a page. */
-dzU32 dzPageGetMaxPeCycles(const dzByte *pagePtr, dzU32 pageSizeInBytes);
+/* 
+    Returns the maximum P/E cycles among `pageCount` pages 
+    starting from the `pageIndex`-th page.
+*/
+dzU32 dzPageGetMaxPeCyclesInRange(const dzPageMetadata *metadata,
+                                  dzU64 pageIndex,
+                                  dzU64 pageCount);
 
 /* Returns the size of `dzPageMetadata`. */
 dzUSize dzPageGetMetadataSize(void);
 
-/* ========================================================================> */
+/* Returns the size of the per-page arrays for `pageCount` pages. */
+dzUSize dzPageGetArrayRegionSize(dzU64 pageCount);
+
+/* Returns the number of metadata bytes stored for each page. */
+dzUSize dzPageGetSpareSize(void);
 
-/* Returns the physical page address of a page. */
-dzPPA dzPageGetPPA(const dzByte *pagePtr, dzU32 pageSizeInBytes);
+/* ========================================================================> */
 
-/* Returns the current state of a page. */
-dzPageState dzPageGetState(const dzByte *pagePtr, dzU32 pageSizeInBytes);
+/* Returns the current state of the `pageIndex`-th page. */
+dzPageState dzPageGetState(const dzPageMetadata *metadata, dzU64 pageIndex);
 
-/* Returns the read latency of a page, in milliseconds. */
-dzResult dzPageGetReadLatency(const dzByte *pagePtr,
-                              dzU32 pageSizeInBytes,
+/* Returns the read latency of the `pageIndex`-th page, in milliseconds. */
+dzResult dzPageGetReadLatency(dzPageMetadata *metadata,
+                              dzU64 pageIndex,
+                              dzRng *rng,
                               dzF64 *tR);
 
-/* Returns the maximum program latency of a page, in milliseconds. */
-dzResult dzPageGetMaxProgramLatency(const dzByte *pagePtr,
-                                    dzU32 pageSizeInBytes,
+/* Returns the maximum program latency of all pages, in milliseconds. */
+dzResult dzPageGetMaxProgramLatency(const dzPageMetadata *metadata,
                                     dzF64 *tPROG);
 
-/* Returns the maximum read latency of a page, in milliseconds. */
-dzResult dzPageGetMaxReadLatency(const dzByte *pagePtr,
-                                 dzU32 pageSizeInBytes,
-                                 dzF64 *tR);
+/* Returns the maximum read latency of all pages, in milliseconds. */
+dzResult dzPageGetMaxReadLatency(const dzPageMetadata *metadata, dzF64 *tR);
 
 /* ========================================================================> */
 
-/* Returns `true` if the given page is factory-bad. */
-dzBool dzPageIsFactoryBad(dzByte *pagePtr, dzU32 pageSizeInBytes);
+/* Returns `true` if the `pageIndex`-th page is factory-bad. */
+dzBool dzPageIsFactoryBad(const dzPageMetadata *metadata, dzU64 pageIndex);
 
-/* Marks a page as bad. */
-dzResult dzPageMarkAsBad(dzByte *pagePtr, dzU32 pageSizeInBytes);
+/* Marks the `pageIndex`-th page as bad. */
+dzResult dzPageMarkAsBad(dzPageMetadata *metadata, dzU64 pageIndex);
 
-/* Marks a page as factory-bad. */
-dzResult dzPageMarkAsFactoryBad(dzByte *pagePtr, dzU32 pageSizeInBytes);
+/* Marks the `pageIndex`-th page as factory-bad. */
+dzResult dzPageMarkAsFactoryBad(dzPageMetadata *metadata, dzU64 pageIndex);
 
-/* Marks a page as free. */
-dzResult dzPageMarkAsFree(dzByte *pagePtr, dzU32 pageSizeInBytes);
+/* Marks the `pageIndex`-th page as free. */
+dzResult dzPageMarkAsFree(dzPageMetadata *metadata, dzU64 pageIndex);
 
-/* Marks a page as reserved. */
-dzResult dzPageMarkAsReserved(dzByte *pagePtr, dzU32 pageSizeInBytes);
+/* Marks the `pageIndex`-th page as invalid. */
+dzResult dzPageMarkAsInvalid(dzPageMetadata *metadata, dzU64 pageIndex);
 
-/* Marks a page as unknown. */
-dzResult dzPageMarkAsUnknown(dzByte *pagePtr, dzU32 pageSizeInBytes);
+/* Marks the `pageIndex`-th page as reserved. */
+dzResult dzPageMarkAsReserved(dzPageMetadata *metadata, dzU64 pageIndex);
 
-/* Marks a page as valid. */
-dzResult dzPageMarkAsValid(dzByte *pagePtr,
-                           dzU32 pageSizeInBytes,
+/* Marks the `pageIndex`-th page as unknown. */
+dzResult dzPageMarkAsUnknown(dzPageMetadata *metadata, dzU64 pageIndex);
+
+/* Marks the `pageIndex`-th page as valid. */
+dzResult dzPageMarkAsValid(dzPageMetadata *metadata,
+                           dzU64 pageIndex,
+                           dzRng *rng,
                            dzF64 *tPROG);
 
 /* <---------------------------------------------------------- [src/plane.c] */
 
-/* Initializes a plane metadata within the given `metadata` region. */
-dzResult dzPlaneInitMetadata(dzPlaneMetadata *metadata, dzPlaneConfig config);
+/* 
+    Initializes a plane metadata within the given `metadata` region, 
+    placing its block state maps in `mapRegion`.
+*/
+dzResult dzPlaneInitMetadata(dzPlaneMetadata *metadata,
+                             dzByte *mapRegion,
+                             dzPlaneConfig config);
 
-/* De-initializes the plane `metadata`. */
-void dzPlaneDeinitMetadata(dzPlaneMetadata *metadata);
+/* 
+    Returns the size of the block state maps 
+    of a plane with `blockCount` blocks.
+*/
+dzUSize dzPlaneGetMapRegionSize(dzU64 blockCount);
 
 /* Returns the size of `dzPlaneMetadata`. */
 dzUSize dzPlaneGetMetadataSize(void);
 
 /* ========================================================================> */
 
+/* 
+    Returns the identifier of the first block in `blockState` 
+    at or after `blockId` within a plane.
+*/
+dzU64 dzPlaneFindNextBlockId(const dzPlaneMetadata *metadata,
+                             dzBlockState blockState,
+                             dzU64 blockId);
+
+/* Returns the number of blocks in `blockState` within a plane. */
+dzU64 dzPlaneGetBlockCountByState(const dzPlaneMetadata *metadata,
+                                  dzBlockState blockState);
+
+/* Returns the state of the `blockId`-th block within a plane. */
+dzBlockState dzPlaneGetBlockState(const dzPlaneMetadata *metadata,
+                                  dzU64 blockId);
+
+/* Returns the number of invalid pages within a plane. */
+dzU64 dzPlaneGetInvalidPageCount(const dzPlaneMetadata *metadata);
+
 /* Returns the identifier of the least worn block within a plane. */
 dzU64 dzPlaneGetLeastWornBlockId(const dzPlaneMetadata *metadata);
 
+/* Returns the number of valid pages within a plane. */
+dzU64 dzPlaneGetValidPageCount(const dzPlaneMetadata *metadata);
+
 /* Updates the state of the given block within a plane's block state map. */
 dzResult dzPlaneUpdateBlockStateMap(dzPlaneMetadata *metadata,
                                     dzPBA pba,
                                     dzBlockState blockState);
 
+/* 
+    Moves `pageCount` pages from `oldState` to `newState` 
+    within a plane's page counters.
+*/
+dzResult dzPlaneUpdatePageCounts(dzPlaneMetadata *metadata,
+                                 dzPageState oldState,
+                                 dzPageState newState,
+                                 dzU64 pageCount);
+
 /* Updates the information for the least worn block within a plane. */
 dzResult dzPlaneUpdateLeastWornBlock(dzPlaneMetadata *metadata,
                                      dzPBA pba,
                                      dzU64 eraseCount);
 
+/* ========================================================================> */
+
+/* Returns the size of the state of a plane with `blockCount` blocks. */
+dzUSize dzPlaneGetStateSize(dzU64 blockCount);
+
+/* Reads the state of a plane from `src`. */
+dzResult dzPlaneReadState(dzPlaneMetadata *metadata, dzByteStream *src);
+
+/* Writes the state of a plane to `dst`. */
+dzResult dzPlaneWriteState(const dzPlaneMetadata *metadata,
+                           dzByteStream *dst);
+
+/* <---------------------------------------------------------- [src/queue.c] */
+
+/* Initializes `*queue` with the given `config`. */
+dzResult dzQueueInit(dzQueue **queue, dzQueueConfig config);
+
+/* Releases the memory allocated for `queue`. */
+void dzQueueDeinit(dzQueue *queue);
+
+/* ========================================================================> */
+
+/* Returns the number of entries in each queue of `queue`. */
+dzU32 dzQueueGetDepth(const dzQueue *queue);
+
+/* ========================================================================> */
+
+/* 
+    Places `op` in the submission queue of `queue`, without making it 
+    visible to the simulator until the next doorbell (host thread only).
+*/
+dzResult dzQueueSubmit(dzQueue *queue, dzSimOp *op);
+
+/* 
+    Makes all operations placed in the submission queue of `queue` 
+    since the last doorbell visible to the simulator (host thread only).
+*/
+void dzQueueRingDoorbell(dzQueue *queue);
+
+/* 
+    Removes up to `count` completed operations from the completion queue 
+    of `queue`, stores them in `ops`, and returns the number of 
+    removed operations (host thread only).
+*/
+dzU64 dzQueuePollCompletions(dzQueue *queue, dzSimOp **ops, dzU64 count);
+
+/* 
+    Submits all visible operations in the submission queue of `queue` 
+    to `sim`, routed through `ssd` unless it is `NULL`, and returns 
+    the number of submitted operations (simulator thread only).
+*/
+dzU64 dzQueueProcess(dzQueue *queue, dzSSD *ssd, dzSim *sim);
+
+/* <------------------------------------------------------------ [src/sim.c] */
+
+/* Initializes `*sim` with the given `config`. */
+dzResult dzSimInit(dzSim **sim, dzSimConfig config);
+
+/* Releases the memory allocated for `sim`. */
+void dzSimDeinit(dzSim *sim);
+
+/* ========================================================================> */
+
+/* Returns the current time of `sim`, in nanoseconds. */
+dzU64 dzSimGetCurrentTime(const dzSim *sim);
+
+/* Returns the number of events in `sim` that have not been processed yet. */
+dzU64 dzSimGetPendingEventCount(const dzSim *sim);
+
+/* Returns the total number of events processed by `sim`. */
+dzU64 dzSimGetProcessedEventCount(const dzSim *sim);
+
+/* ========================================================================> */
+
+/* 
+    Processes all events in `sim` scheduled at or before `endTime`, 
+    and returns the number of processed events.
+*/
+dzU64 dzSimRun(dzSim *sim, dzU64 endTime);
+
+/* 
+    Processes all events in the `simCount` simulators in `sims` 
+    scheduled at or before `endTime` in parallel, and returns 
+    the number of processed events.
+*/
+dzU64 dzSimRunParallel(dzSim **sims,
+                       dzU32 simCount,
+                       dzU64 endTime,
+                       dzSimParallelConfig config);
+
+/* 
+    Schedules `callback` to be called with `ctx`, 
+    `delay` nanoseconds after the current time of `sim`.
+*/
+dzResult dzSimSchedule(dzSim *sim,
+                       dzU64 delay,
+                       dzSimEventCallback callback,
+                       void *ctx);
+
+/* 
+    Processes the earliest event in `sim`, and returns `false` 
+    if there are no events left.
+*/
+dzBool dzSimStep(dzSim *sim);
+
+/* 
+    Schedules `op` to be started `delay` nanoseconds after 
+    the current time of `sim`.
+*/
+dzResult dzSimSubmitOp(dzSim *sim, dzSimOp *op, dzU64 delay);
+
+/* <------------------------------------------------------------ [src/ssd.c] */
+
+/* Initializes `*ssd` with the given `config`. */
+dzResult dzSSDInit(dzSSD **ssd, dzSSDConfig config);
+
+/* Releases the memory allocated for `ssd`. */
+void dzSSDDeinit(dzSSD *ssd);
+
+/* ========================================================================> */
+
+/* Returns the `channelId`-th channel in `ssd`. */
+dzChannel *dzSSDGetChannel(const dzSSD *ssd, dzU64 channelId);
+
+/* Returns the number of channels in `ssd`. */
+dzU32 dzSSDGetChannelCount(const dzSSD *ssd);
+
+/* Returns the die that `ppa` is pointing to within `ssd`. */
+dzDie *dzSSDGetDie(const dzSSD *ssd, dzPPA ppa);
+
+/* Returns the total number of dies in `ssd`. */
+dzU64 dzSSDGetDieCount(const dzSSD *ssd);
+
+/* 
+    Returns the lookahead of `ssd` for a parallel run with 
+    one simulator per channel, in nanoseconds.
+*/
+dzU64 dzSSDGetLookahead(const dzSSD *ssd);
+
+/* Returns the first physical page address within `ssd`. */
+dzPPA dzSSDGetFirstPPA(const dzSSD *ssd);
+
+/* Returns the next physical page address following `ppa` within `ssd`. */
+dzPPA dzSSDGetNextPPA(const dzSSD *ssd, dzPPA ppa);
+
+/* ========================================================================> */
+
+/* Returns the total number of invalid pages in `ssd`. */
+dzU64 dzSSDGetInvalidPageCount(const dzSSD *ssd);
+
+/* Returns the total number of pages in `ssd`. */
+dzU64 dzSSDGetPageCount(const dzSSD *ssd);
+
+/* Returns the total number of valid pages in `ssd`. */
+dzU64 dzSSDGetValidPageCount(const dzSSD *ssd);
+
+/* ========================================================================> */
+
+/* Returns the total number of program operations performed on `ssd`. */
+dzU64 dzSSDGetTotalProgramCount(const dzSSD *ssd);
+
+/* Returns the total number of read operations performed on `ssd`. */
+dzU64 dzSSDGetTotalReadCount(const dzSSD *ssd);
+
+/* Returns the total number of erase operations performed on `ssd`. */
+dzU64 dzSSDGetTotalEraseCount(const dzSSD *ssd);
+
+/* ========================================================================> */
+
+/* Writes `src.ptr` to the page corresponding to `ppa` in `ssd`. */
+dzResult dzSSDProgramPage(dzSSD *ssd, dzPPA ppa, dzByteArray src);
+
+/* 
+    Reads data from the page corresponding to `ppa` in `ssd`, 
+    and copies it to `dst.ptr`. 
+*/
+dzResult dzSSDReadPage(dzSSD *ssd, dzPPA ppa, dzByteArray dst);
+
+/* Erases the block corresponding to `pba` in `ssd`. */
+dzResult dzSSDEraseBlock(dzSSD *ssd, dzPBA pba);
+
+/* 
+    Routes `op` to the die and the channel that its address is pointing to, 
+    and schedules it to be started `delay` nanoseconds after 
+    the current time of `sim`.
+*/
+dzResult dzSSDSubmitOp(dzSSD *ssd, dzSim *sim, dzSimOp *op, dzU64 delay);
+
 /* <---------------------------------------------------------- [src/utils.c] */
 
 /* Returns a pseudo-random number from a Gaussian distribution. */
 dzF64 dzUtilsGaussian(dzF64 mu, dzF64 sigma);
 
+/* Returns the 64-bit hash value of `src.ptr`. */
+dzU64 dzUtilsHash64(dzByteArray src);
+
 /* Returns a pseudo-random unsigned 64-bit integer. */
 dzU64 dzUtilsRand(void);
 
@@ -560,6 +1393,96 @@ dzU64 dzUtilsRandRange(dzU64 min, dzU64 max);
 */
 dzF64 dzUtilsRandRangeF64(dzF64 min, dzF64 max);
 
+/* Seeds the pseudo-random number generator of the calling thread. */
+void dzUtilsSetSeed(dzU64 seed);
+
+/* ========================================================================> */
+
+/* 
+    Returns a pseudo-random number from a Gaussian distribution, 
+    drawn from `rng` (or the generator of the calling thread if `NULL`).
+*/
+dzF64 dzUtilsRngGaussian(dzRng *rng, dzF64 mu, dzF64 sigma);
+
+/* 
+    Fills `dst` with `count` pseudo-random numbers from a Gaussian 
+    distribution, drawn from `rng` (or the generator of the calling 
+    thread if `NULL`).
+*/
+void dzUtilsRngGaussianFill(dzRng *rng,
+                            dzF64 *dst,
+                            dzUSize count,
+                            dzF64 mu,
+                            dzF64 sigma);
+
+/* 
+    Seeds `rng` (or the generator of the calling thread if `NULL`) 
+    with the given `seed`.
+*/
+void dzUtilsRngInit(dzRng *rng, dzU64 seed);
+
+/* 
+    Advances `rng` by 2^128 steps, which can be used to generate 
+    2^128 non-overlapping streams for parallel computations.
+*/
+void dzUtilsRngJump(dzRng *rng);
+
+/* 
+    Advances `rng` by 2^192 steps, which can be used to generate 
+    2^64 starting points, each of them with 2^64 streams.
+*/
+void dzUtilsRngLongJump(dzRng *rng);
+
+/* 
+    Returns a pseudo-random unsigned 64-bit integer, 
+    drawn from `rng` (or the generator of the calling thread if `NULL`).
+*/
+dzU64 dzUtilsRngNext(dzRng *rng);
+
+/* 
+    Returns a pseudo-random unsigned 64-bit integer in the given 
+    (inclusive) range, drawn from `rng` (or the generator of 
+    the calling thread if `NULL`).
+*/
+dzU64 dzUtilsRngRange(dzRng *rng, dzU64 min, dzU64 max);
+
+/* 
+    Returns a pseudo-random double-precision floating-point number 
+    in the given (exclusive) range, drawn from `rng` (or the generator 
+    of the calling thread if `NULL`).
+*/
+dzF64 dzUtilsRngRangeF64(dzRng *rng, dzF64 min, dzF64 max);
+
+/* ========================================================================> */
+
+/* Returns the number of bits set in the first `bitCount` bits of `bitmap`. */
+dzU64 dzUtilsBitmapCount(const dzU64 *bitmap, dzU64 bitCount);
+
+/* Sets (or clears) all of the first `bitCount` bits of `bitmap`. */
+void dzUtilsBitmapFill(dzU64 *bitmap, dzU64 bitCount, dzBool value);
+
+/* 
+    Returns the index of the first bit set in `bitmap` at or after 
+    `startIndex`, or `UINT64_MAX` if there is no such bit.
+*/
+dzU64 dzUtilsBitmapFindNext(const dzU64 *bitmap,
+                            dzU64 bitCount,
+                            dzU64 startIndex);
+
+/* ========================================================================> */
+
+/* 
+    Copies `size` bytes from `src->ptr` to `dst`, 
+    and advances `src->offset`.
+*/
+dzBool dzUtilsReadStream(dzByteStream *src, void *dst, dzUSize size);
+
+/* 
+    Copies `size` bytes from `src` to `dst->ptr`, 
+    and advances `dst->offset`.
+*/
+dzBool dzUtilsWriteStream(dzByteStream *dst, const void *src, dzUSize size);
+
 /* ========================================================================> */
 
 /* Returns `value` clamped to the inclusive range of `low` and `high`. */
@@ -567,10 +1490,54 @@ DZ_API_INLINE dzF64 dzUtilsClampF64(dzF64 value, dzF64 low, dzF64 high) {
     return (value >= low) ? ((value <= high) ? value : high) : low;
 }
 
+/* Returns the number of 64-bit words required to store `bitCount` bits. */
+DZ_API_INLINE dzU64 dzUtilsBitmapGetWordCount(dzU64 bitCount) {
+    return (bitCount + 63U) >> 6;
+}
+
+/* Clears the `index`-th bit of `bitmap`. */
+DZ_API_INLINE void dzUtilsBitmapClear(dzU64 *bitmap, dzU64 index) {
+    bitmap[index >> 6] &= ~(UINT64_C(1) << (index & 63U));
+}
+
+/* Sets the `index`-th bit of `bitmap`. */
+DZ_API_INLINE void dzUtilsBitmapSet(dzU64 *bitmap, dzU64 index) {
+    bitmap[index >> 6] |= (UINT64_C(1) << (index & 63U));
+}
+
+/* Returns `true` if the `index`-th bit of `bitmap` is set. */
+DZ_API_INLINE bool dzUtilsBitmapTest(const dzU64 *bitmap, dzU64 index) {
+    return ((bitmap[index >> 6] >> (index & 63U)) & 1U) != 0U;
+}
+
+/* Returns the number of bits set in `x`. */
+DZ_API_INLINE dzU64 dzUtilsPopCount64(dzU64 x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (dzU64) __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & UINT64_C(0x5555555555555555));
+    x = (x & UINT64_C(0x3333333333333333))
+        + ((x >> 2) & UINT64_C(0x3333333333333333));
+    x = (x + (x >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+
+    return (x * UINT64_C(0x0101010101010101)) >> 56;
+#endif
+}
+
+/* Returns the number of trailing zero bits in `x`, which must not be `0`. */
+DZ_API_INLINE dzU64 dzUtilsCountTrailingZeros64(dzU64 x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (dzU64) __builtin_ctzll(x);
+#else
+    return dzUtilsPopCount64((x & (~x + 1U)) - 1U);
+#endif
+}
+
 /* Returns `true` if `pba1` equals to `pba2`. */
 DZ_API_INLINE bool dzUtilsPBAEquals(dzPBA pba1, dzPBA pba2) {
-    return (pba1.chipId == pba2.chipId) && (pba1.dieId == pba2.dieId)
-           && (pba1.planeId == pba2.planeId) && (pba1.blockId == pba2.blockId);
+    return (pba1.channelId == pba2.channelId) && (pba1.chipId == pba2.chipId)
+           && (pba1.dieId == pba2.dieId) && (pba1.planeId == pba2.planeId)
+           && (pba1.blockId == pba2.blockId);
 }
 
 /* ========================================================================> */
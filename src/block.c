@@ -22,8 +22,6 @@
 
 /* Includes ===============================================================> */
 
-#include <string.h>
-
 #include "ssdeez.h"
 
 /* Macros =================================================================> */
@@ -34,7 +32,8 @@
 
 /* A structure that represents the metadata of a NAND flash block. */
 struct dzBlockMetadata_ {
-    dzByte *pageStateMap;
+    dzU64 *pageStateMaps;
+    dzU64 pageStateCounts[DZ_PAGE_STATE_COUNT_];
     dzPBA physicalBlockAddress;
     dzU64 pageCount;
     dzU64 nextPageId;
@@ -65,21 +64,39 @@ const dzU64 DZ_BLOCK_INVALID_ID = UINT64_MAX;
 
 /* Private Function Prototypes ============================================> */
 
-// TODO: ...
+/* Marks all pages in a block as `pageState`. */
+static void dzBlockFillPageStateMaps(dzBlockMetadata *metadata,
+                                     dzPageState pageState);
 
-/* Public Functions =======================================================> */
+/* Marks the `pageId`-th page in a block as `pageState`. */
+static void dzBlockSetPageState(dzBlockMetadata *metadata,
+                                dzU64 pageId,
+                                dzPageState pageState);
 
-/* Initializes a block metadata within the given `metadata` region. */
-dzResult dzBlockInitMetadata(dzBlockMetadata *metadata, dzBlockConfig config) {
-    if (metadata == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+/* ========================================================================> */
 
-    {
-        metadata->pageStateMap = malloc(config.pageCount
-                                        * sizeof *(metadata->pageStateMap));
+/* Returns the pointer to the page state bitmap of `pageState`. */
+DZ_API_STATIC_INLINE dzU64 *dzBlockGetPageStateMap(
+    const dzBlockMetadata *metadata,
+    dzPageState pageState);
 
-        for (dzU64 i = 0U; i < config.pageCount; i++)
-            metadata->pageStateMap[i] = DZ_PAGE_STATE_FREE;
-    }
+/* Returns `true` if `pageState` has its own page state bitmap. */
+DZ_API_STATIC_INLINE dzBool dzBlockIsValidPageState(dzPageState pageState);
+
+/* Public Functions =======================================================> */
+
+/* 
+    Initializes a block `metadata` within the given region, 
+    placing its page state maps in `mapRegion`.
+*/
+dzResult dzBlockInitMetadata(dzBlockMetadata *metadata,
+                             dzByte *mapRegion,
+                             dzBlockConfig config) {
+    if (metadata == NULL || mapRegion == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: One bitmap for each page state, packed into 64-bit words
+    metadata->pageStateMaps = (dzU64 *) mapRegion;
 
     {
         metadata->physicalBlockAddress = config.physicalBlockAddress;
@@ -93,6 +110,8 @@ dzResult dzBlockInitMetadata(dzBlockMetadata *metadata, dzBlockConfig config) {
         metadata->cellType = config.cellType;
 
         metadata->state = DZ_BLOCK_STATE_FREE;
+
+        dzBlockFillPageStateMaps(metadata, DZ_PAGE_STATE_FREE);
     }
 
     {
@@ -106,11 +125,13 @@ dzResult dzBlockInitMetadata(dzBlockMetadata *metadata, dzBlockConfig config) {
     return DZ_RESULT_OK;
 }
 
-/* De-initializes the block `metadata`. */
-void dzBlockDeinitMetadata(dzBlockMetadata *metadata) {
-    if (metadata == NULL) return;
-
-    free(metadata->pageStateMap);
+/* 
+    Returns the size of the page state maps 
+    of a block with `pageCount` pages.
+*/
+dzUSize dzBlockGetMapRegionSize(dzU64 pageCount) {
+    return DZ_PAGE_STATE_COUNT_ * dzUtilsBitmapGetWordCount(pageCount)
+           * sizeof(dzU64);
 }
 
 /* Returns the size of `dzBlockMetadata`. */
@@ -130,6 +151,24 @@ dzResult dzBlockGetMaxEraseLatency(const dzBlockMetadata *metadata,
     return DZ_RESULT_OK;
 }
 
+/* 
+    Returns the identifier of the first page in `pageState` 
+    at or after `pageId` within a block.
+*/
+dzU64 dzBlockFindNextPageId(const dzBlockMetadata *metadata,
+                            dzPageState pageState,
+                            dzU64 pageId) {
+    if (metadata == NULL || !dzBlockIsValidPageState(pageState))
+        return DZ_PAGE_INVALID_ID;
+
+    dzU64 result =
+        dzUtilsBitmapFindNext(dzBlockGetPageStateMap(metadata, pageState),
+                              metadata->pageCount,
+                              pageId);
+
+    return (result != UINT64_MAX) ? result : DZ_PAGE_INVALID_ID;
+}
+
 /* Returns the next page identifier of a block. */
 dzU64 dzBlockGetNextPageId(dzBlockMetadata *metadata) {
     return (metadata != NULL) ? metadata->nextPageId : DZ_PAGE_INVALID_ID;
@@ -138,7 +177,8 @@ dzU64 dzBlockGetNextPageId(dzBlockMetadata *metadata) {
 /* Returns the physical block address of a block. */
 dzPBA dzBlockGetPBA(const dzBlockMetadata *metadata) {
     if (metadata == NULL)
-        return (dzPPA) { .chipId = DZ_CHIP_INVALID_ID,
+        return (dzPPA) { .channelId = DZ_CHANNEL_INVALID_ID,
+                         .chipId = DZ_CHIP_INVALID_ID,
                          .dieId = DZ_DIE_INVALID_ID,
                          .planeId = DZ_PLANE_INVALID_ID,
                          .blockId = DZ_BLOCK_INVALID_ID,
@@ -157,16 +197,35 @@ dzU64 dzBlockGetTotalEraseCount(const dzBlockMetadata *metadata) {
     return (metadata != NULL) ? metadata->totalEraseCount : 0U;
 }
 
-/* Returns the number of valid pages in a block. */
-dzU64 dzBlockGetValidPageCount(const dzBlockMetadata *metadata) {
-    if (metadata == NULL) return 0U;
+/* Returns the number of pages in `pageState` within a block. */
+dzU64 dzBlockGetPageCountByState(const dzBlockMetadata *metadata,
+                                 dzPageState pageState) {
+    if (metadata == NULL || !dzBlockIsValidPageState(pageState)) return 0U;
 
-    dzU64 validPageCount = 0U;
+    return metadata->pageStateCounts[pageState];
+}
+
+/* Returns the state of the `pageId`-th page within a block. */
+dzPageState dzBlockGetPageState(const dzBlockMetadata *metadata,
+                                dzU64 pageId) {
+    if (metadata == NULL || pageId >= metadata->pageCount)
+        return DZ_PAGE_STATE_UNKNOWN;
 
-    for (dzU64 i = 0U; i < metadata->pageCount; i++)
-        validPageCount += (metadata->pageStateMap[i] == DZ_PAGE_STATE_VALID);
+    for (dzI32 i = DZ_PAGE_STATE_FREE; i < DZ_PAGE_STATE_COUNT_; i++)
+        if (dzUtilsBitmapTest(dzBlockGetPageStateMap(metadata, i), pageId))
+            return (dzPageState) i;
 
-    return validPageCount;
+    return DZ_PAGE_STATE_UNKNOWN;
+}
+
+/* Returns the number of invalid pages in a block. */
+dzU64 dzBlockGetInvalidPageCount(const dzBlockMetadata *metadata) {
+    return dzBlockGetPageCountByState(metadata, DZ_PAGE_STATE_INVALID);
+}
+
+/* Returns the number of valid pages in a block. */
+dzU64 dzBlockGetValidPageCount(const dzBlockMetadata *metadata) {
+    return dzBlockGetPageCountByState(metadata, DZ_PAGE_STATE_VALID);
 }
 
 /* ========================================================================> */
@@ -187,15 +246,13 @@ dzResult dzBlockAdvanceNextPageId(dzBlockMetadata *metadata) {
 dzResult dzBlockMarkAsActive(dzBlockMetadata *metadata) {
     if (metadata == NULL) {
         return DZ_RESULT_INVALID_ARGUMENT;
-    } else if (metadata->state == DZ_BLOCK_STATE_BAD) {
+    } else if (metadata->state == DZ_BLOCK_STATE_BAD
+               || metadata->state == DZ_BLOCK_STATE_VICTIM) {
         return DZ_RESULT_INVALID_STATE;
     } else {
+        // NOTE: Only the programmed pages are valid in an active block
         metadata->state = DZ_BLOCK_STATE_ACTIVE;
 
-        memset(metadata->pageStateMap,
-               DZ_PAGE_STATE_VALID,
-               metadata->pageCount);
-
         return DZ_RESULT_OK;
     }
 }
@@ -210,14 +267,16 @@ dzResult dzBlockMarkAsBad(dzBlockMetadata *metadata) {
         metadata->nextPageId = DZ_PAGE_INVALID_ID;
         metadata->state = DZ_BLOCK_STATE_BAD;
 
-        memset(metadata->pageStateMap, DZ_PAGE_STATE_BAD, metadata->pageCount);
+        dzBlockFillPageStateMaps(metadata, DZ_PAGE_STATE_BAD);
 
         return DZ_RESULT_OK;
     }
 }
 
 /* Marks a block as free. */
-dzResult dzBlockMarkAsFree(dzBlockMetadata *metadata, dzF64 *tBERS) {
+dzResult dzBlockMarkAsFree(dzBlockMetadata *metadata,
+                           dzRng *rng,
+                           dzF64 *tBERS) {
     if (metadata == NULL || tBERS == NULL) return DZ_RESULT_INVALID_ARGUMENT;
     else if (metadata->state == DZ_BLOCK_STATE_BAD
              || metadata->state == DZ_BLOCK_STATE_FREE) {
@@ -228,15 +287,15 @@ dzResult dzBlockMarkAsFree(dzBlockMetadata *metadata, dzF64 *tBERS) {
 
         metadata->totalEraseCount++;
 
-        memset(metadata->pageStateMap,
-               DZ_PAGE_STATE_FREE,
-               metadata->pageCount);
+        dzBlockFillPageStateMaps(metadata, DZ_PAGE_STATE_FREE);
 
         {
-            dzF64 rawLatency =
-                dzUtilsGaussian(eraseLatencyTable[metadata->cellType],
-                                DZ_BLOCK_ERASE_LATENCY_STDDEV_RATIO
-                                    * eraseLatencyTable[metadata->cellType]);
+            dzF64 meanLatency = eraseLatencyTable[metadata->cellType];
+
+            dzF64 rawLatency = dzUtilsRngGaussian(
+                rng,
+                meanLatency,
+                DZ_BLOCK_ERASE_LATENCY_STDDEV_RATIO * meanLatency);
 
             dzF64 maxLatency = metadata->maxEraseLatency;
 
@@ -264,21 +323,178 @@ dzResult dzBlockMarkAsUnknown(dzBlockMetadata *metadata) {
 
     metadata->state = DZ_BLOCK_STATE_UNKNOWN;
 
-    memset(metadata->pageStateMap, DZ_PAGE_STATE_UNKNOWN, metadata->pageCount);
+    dzBlockFillPageStateMaps(metadata, DZ_PAGE_STATE_UNKNOWN);
+
+    return DZ_RESULT_OK;
+}
+
+/* Marks a block as a victim for garbage collection. */
+dzResult dzBlockMarkAsVictim(dzBlockMetadata *metadata) {
+    if (metadata == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: Only the blocks with programmed pages can be garbage-collected
+    if (metadata->state != DZ_BLOCK_STATE_ACTIVE)
+        return DZ_RESULT_INVALID_STATE;
+
+    metadata->state = DZ_BLOCK_STATE_VICTIM;
 
     return DZ_RESULT_OK;
 }
 
 /* ========================================================================> */
 
+/* Marks the valid `pageId`-th page as invalid within a block. */
+dzResult dzBlockInvalidatePage(dzBlockMetadata *metadata, dzU64 pageId) {
+    if (metadata == NULL || metadata->pageStateMaps == NULL
+        || pageId >= metadata->pageCount)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    if (!dzUtilsBitmapTest(dzBlockGetPageStateMap(metadata,
+                                                  DZ_PAGE_STATE_VALID),
+                           pageId))
+        return DZ_RESULT_INVALID_STATE;
+
+    dzBlockSetPageState(metadata, pageId, DZ_PAGE_STATE_INVALID);
+
+    return DZ_RESULT_OK;
+}
+
 /* Updates the state of the given page within a block's page state map. */
 dzResult dzBlockUpdatePageStateMap(dzBlockMetadata *metadata,
                                    dzPageState pageState) {
     if (metadata == NULL || metadata->nextPageId == DZ_PAGE_INVALID_ID
-        || metadata->pageStateMap == NULL)
+        || metadata->pageStateMaps == NULL
+        || pageState < DZ_PAGE_STATE_UNKNOWN
+        || pageState >= DZ_PAGE_STATE_COUNT_)
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    metadata->pageStateMap[metadata->nextPageId] = (dzByte) pageState;
+    dzBlockSetPageState(metadata, metadata->nextPageId, pageState);
 
     return DZ_RESULT_OK;
 }
+
+/* ========================================================================> */
+
+/* Returns the size of the state of a block with `pageCount` pages. */
+dzUSize dzBlockGetStateSize(dzU64 pageCount) {
+    return sizeof(dzU64)                         // `nextPageId`
+           + sizeof(dzU64)                       // `totalEraseCount`
+           + sizeof(dzI32)                       // `state`
+           + dzBlockGetMapRegionSize(pageCount);  // `pageStateMaps`
+}
+
+/* Reads the state of a block from `src`. */
+dzResult dzBlockReadState(dzBlockMetadata *metadata, dzByteStream *src) {
+    if (metadata == NULL || src == NULL || src->ptr == NULL
+        || src->offset + dzBlockGetStateSize(metadata->pageCount) > src->size)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzI32 state = DZ_BLOCK_STATE_UNKNOWN;
+
+    (void) dzUtilsReadStream(src,
+                             &(metadata->nextPageId),
+                             sizeof metadata->nextPageId);
+
+    (void) dzUtilsReadStream(src,
+                             &(metadata->totalEraseCount),
+                             sizeof metadata->totalEraseCount);
+
+    (void) dzUtilsReadStream(src, &state, sizeof state);
+
+    (void) dzUtilsReadStream(src,
+                             metadata->pageStateMaps,
+                             dzBlockGetMapRegionSize(metadata->pageCount));
+
+    if (state < DZ_BLOCK_STATE_UNKNOWN || state >= DZ_BLOCK_STATE_COUNT_)
+        return DZ_RESULT_INVALID_METADATA;
+
+    metadata->state = (dzBlockState) state;
+
+    // NOTE: Page counters are derived from the page state maps
+    for (dzI32 i = DZ_PAGE_STATE_FREE; i < DZ_PAGE_STATE_COUNT_; i++)
+        metadata->pageStateCounts[i] =
+            dzUtilsBitmapCount(dzBlockGetPageStateMap(metadata, i),
+                               metadata->pageCount);
+
+    return DZ_RESULT_OK;
+}
+
+/* Writes the state of a block to `dst`. */
+dzResult dzBlockWriteState(const dzBlockMetadata *metadata,
+                           dzByteStream *dst) {
+    if (metadata == NULL || dst == NULL || dst->ptr == NULL
+        || dst->offset + dzBlockGetStateSize(metadata->pageCount) > dst->size)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzI32 state = (dzI32) metadata->state;
+
+    (void) dzUtilsWriteStream(dst,
+                              &(metadata->nextPageId),
+                              sizeof metadata->nextPageId);
+
+    (void) dzUtilsWriteStream(dst,
+                              &(metadata->totalEraseCount),
+                              sizeof metadata->totalEraseCount);
+
+    (void) dzUtilsWriteStream(dst, &state, sizeof state);
+
+    (void) dzUtilsWriteStream(dst,
+                              metadata->pageStateMaps,
+                              dzBlockGetMapRegionSize(metadata->pageCount));
+
+    return DZ_RESULT_OK;
+}
+
+/* Private Functions ======================================================> */
+
+/* Marks all pages in a block as `pageState`. */
+static void dzBlockFillPageStateMaps(dzBlockMetadata *metadata,
+                                     dzPageState pageState) {
+    for (dzI32 i = DZ_PAGE_STATE_FREE; i < DZ_PAGE_STATE_COUNT_; i++) {
+        dzUtilsBitmapFill(dzBlockGetPageStateMap(metadata, i),
+                          metadata->pageCount,
+                          (i == (dzI32) pageState));
+
+        metadata->pageStateCounts[i] = (i == (dzI32) pageState)
+                                           ? metadata->pageCount
+                                           : 0U;
+    }
+}
+
+/* Marks the `pageId`-th page in a block as `pageState`. */
+static void dzBlockSetPageState(dzBlockMetadata *metadata,
+                                dzU64 pageId,
+                                dzPageState pageState) {
+    for (dzI32 i = DZ_PAGE_STATE_FREE; i < DZ_PAGE_STATE_COUNT_; i++) {
+        dzU64 *pageStateMap = dzBlockGetPageStateMap(metadata, i);
+
+        if (!dzUtilsBitmapTest(pageStateMap, pageId)) continue;
+
+        dzUtilsBitmapClear(pageStateMap, pageId);
+
+        metadata->pageStateCounts[i]--;
+    }
+
+    if (pageState == DZ_PAGE_STATE_UNKNOWN) return;
+
+    dzUtilsBitmapSet(dzBlockGetPageStateMap(metadata, pageState), pageId);
+
+    metadata->pageStateCounts[pageState]++;
+}
+
+/* ========================================================================> */
+
+/* Returns the pointer to the page state bitmap of `pageState`. */
+DZ_API_STATIC_INLINE dzU64 *dzBlockGetPageStateMap(
+    const dzBlockMetadata *metadata,
+    dzPageState pageState) {
+    return metadata->pageStateMaps
+           + ((dzU64) pageState
+              * dzUtilsBitmapGetWordCount(metadata->pageCount));
+}
+
+/* Returns `true` if `pageState` has its own page state bitmap. */
+DZ_API_STATIC_INLINE dzBool dzBlockIsValidPageState(dzPageState pageState) {
+    return (pageState > DZ_PAGE_STATE_UNKNOWN
+            && pageState < DZ_PAGE_STATE_COUNT_);
+}
@@ -0,0 +1,219 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// TODO: ...
+
+/* Typedefs ===============================================================> */
+
+/* A structure that represents a channel (shared bus) of NAND flash chips. */
+struct dzChannel_ {
+    dzChannelConfig config;
+    dzChipConfig chipConfig;
+    dzDieConfig dieConfig;
+    dzChip **chips;
+    dzU64 busReadyTime;  // in nanoseconds
+    dzU64 busBusyTime;   // in nanoseconds
+};
+
+/* Constants ==============================================================> */
+
+/* A constant that represents an invalid channel identifier. */
+const dzU64 DZ_CHANNEL_INVALID_ID = UINT64_MAX;
+
+/* Private Variables ======================================================> */
+
+// TODO: ...
+
+/* Private Function Prototypes ============================================> */
+
+// TODO: ...
+
+/* Public Functions =======================================================> */
+
+/* Initializes `*channel` with the given `config`. */
+dzResult dzChannelInit(dzChannel **channel, dzChannelConfig config) {
+    // clang-format off
+
+    if (channel == NULL
+        || config.chipConfig == NULL
+        || config.chipConfig->dieConfig == NULL
+        || config.channelId == DZ_CHANNEL_INVALID_ID
+        || config.chipCount == 0U
+        || dzOnfiGetCycleTime(config.timingMode) == 0U)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // clang-format on
+
+    dzChannel *newChannel = malloc(sizeof *newChannel);
+
+    if (newChannel == NULL) return DZ_RESULT_NO_MEMORY;
+
+    {
+        // NOTE: The chip and die configurations are owned by the caller
+        newChannel->chipConfig = *(config.chipConfig);
+        newChannel->dieConfig = *(config.chipConfig->dieConfig);
+
+        newChannel->config = config;
+        newChannel->config.chipConfig = &(newChannel->chipConfig);
+
+        newChannel->chipConfig.dieConfig = &(newChannel->dieConfig);
+
+        // NOTE: All dies in a channel transfer data at the speed of the bus
+        newChannel->dieConfig.ioCycleTime = dzOnfiGetCycleTime(
+            config.timingMode);
+
+        newChannel->chips = calloc(config.chipCount,
+                                   sizeof *(newChannel->chips));
+
+        newChannel->busReadyTime = newChannel->busBusyTime = 0U;
+    }
+
+    if (newChannel->chips == NULL) {
+        free(newChannel);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    {
+        dzRng rng;
+
+        // NOTE: Each channel, and then each chip, gets its own master seed
+        dzUtilsRngInit(&rng, config.chipConfig->seed);
+
+        for (dzU64 i = 0U; i < config.channelId; i++)
+            dzUtilsRngLongJump(&rng);
+
+        for (dzU32 i = 0U; i < config.chipCount; i++) {
+            dzChipConfig chipConfig = newChannel->chipConfig;
+
+            chipConfig.chipId = i, chipConfig.seed = dzUtilsRngNext(&rng);
+
+            if (dzChipInit(&(newChannel->chips[i]), chipConfig)
+                == DZ_RESULT_OK)
+                continue;
+
+            dzChannelDeinit(newChannel);
+
+            return DZ_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    *channel = newChannel;
+
+    return DZ_RESULT_OK;
+}
+
+/* Releases the memory allocated for `channel`. */
+void dzChannelDeinit(dzChannel *channel) {
+    if (channel == NULL) return;
+
+    for (dzU32 i = 0U; i < channel->config.chipCount; i++)
+        dzChipDeinit(channel->chips[i]);
+
+    free(channel->chips), free(channel);
+}
+
+/* ========================================================================> */
+
+/* Returns the bandwidth of the bus of `channel`, in bytes per nanosecond. */
+dzF64 dzChannelGetBandwidth(const dzChannel *channel) {
+    if (channel == NULL) return 0.0;
+
+    // NOTE: One byte is transferred per cycle on an 8-bit bus
+    return 1.0 / (dzF64) channel->dieConfig.ioCycleTime;
+}
+
+/* Returns the `chipId`-th chip in `channel`. */
+dzChip *dzChannelGetChip(const dzChannel *channel, dzU64 chipId) {
+    return (channel != NULL && chipId < channel->config.chipCount)
+               ? channel->chips[chipId]
+               : NULL;
+}
+
+/* Returns the number of chips in `channel`. */
+dzU32 dzChannelGetChipCount(const dzChannel *channel) {
+    return (channel != NULL) ? channel->config.chipCount : 0U;
+}
+
+/* ========================================================================> */
+
+/* 
+    Returns the total time that the bus of `channel` has been busy, 
+    in nanoseconds.
+*/
+dzU64 dzChannelGetBusBusyTime(const dzChannel *channel) {
+    return (channel != NULL) ? channel->busBusyTime : 0U;
+}
+
+/* 
+    Returns the time at which the bus of `channel` becomes free, 
+    in nanoseconds.
+*/
+dzU64 dzChannelGetBusReadyTime(const dzChannel *channel) {
+    return (channel != NULL) ? channel->busReadyTime : 0U;
+}
+
+/* 
+    Returns the fraction of the time until `time` during which 
+    the bus of `channel` has been busy.
+*/
+dzF64 dzChannelGetBusUtilization(const dzChannel *channel, dzU64 time) {
+    if (channel == NULL || time == 0U) return 0.0;
+
+    // NOTE: Exclude the part of the current transfer that lies ahead
+    dzU64 pendingTime = (channel->busReadyTime > time)
+                            ? (channel->busReadyTime - time)
+                            : 0U;
+
+    if (pendingTime >= channel->busBusyTime) return 0.0;
+
+    return (dzF64) (channel->busBusyTime - pendingTime) / (dzF64) time;
+}
+
+/* 
+    Marks the bus of `channel` as busy for `duration` nanoseconds 
+    from `startTime`, if it is free at `startTime`.
+*/
+dzResult dzChannelMarkBusAsBusy(dzChannel *channel,
+                                dzU64 startTime,
+                                dzU64 duration) {
+    if (channel == NULL || duration > (UINT64_MAX - startTime))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: Only one die can drive the shared bus at a time
+    if (channel->busReadyTime > startTime) return DZ_RESULT_BUSY;
+
+    channel->busReadyTime = startTime + duration;
+    channel->busBusyTime += duration;
+
+    return DZ_RESULT_OK;
+}
+
+/* Private Functions ======================================================> */
+
+// TODO: ...
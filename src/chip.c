@@ -22,6 +22,11 @@
 
 /* Includes ===============================================================> */
 
+#include <string.h>
+
+#include <pthread.h>
+#include <unistd.h>
+
 #include "ssdeez.h"
 
 /* Macros =================================================================> */
@@ -33,13 +38,37 @@
 /* A structure that represents a NAND flash chip. */
 struct dzChip_ {
     dzChipConfig config;
+    dzDieConfig dieConfig;
     dzDie **dies;
-    bool isReady;  // R/B#
     // TODO: ...
 };
 
+/* A structure that represents the header of a chip snapshot. */
+typedef struct dzChipSnapshotHeader_ {
+    dzByte magic[8];
+    dzU32 version;
+    dzU32 dieCount;
+    dzU64 chipId;
+} dzChipSnapshotHeader;
+
+/* A structure that represents the shared state of die initialization. */
+typedef struct dzChipInitContext_ {
+    dzChip *chip;
+    dzU32 nextDieId;
+} dzChipInitContext;
+
 /* Constants ==============================================================> */
 
+/* The magic number of a chip snapshot. */
+static const dzByte DZ_CHIP_SNAPSHOT_MAGIC[8] = { 'S', 'S', 'D', 'E',
+                                                  'E', 'Z', 'C', 'S' };
+
+/* The current version of a chip snapshot. */
+static const dzU32 DZ_CHIP_SNAPSHOT_VERSION = 1U;
+
+/* The size of the buffer used for streaming a chip snapshot, in bytes. */
+static const dzUSize DZ_CHIP_SNAPSHOT_BUFFER_SIZE = 1U << 20U;
+
 /* A constant that represents an invalid chip identifier. */
 const dzU64 DZ_CHIP_INVALID_ID = UINT64_MAX;
 
@@ -49,7 +78,11 @@ const dzU64 DZ_CHIP_INVALID_ID = UINT64_MAX;
 
 /* Private Function Prototypes ============================================> */
 
-// TODO: ...
+/* Initializes the dies in `chip` on `threadCount` threads. */
+static void dzChipInitDies(dzChip *chip, dzU32 threadCount);
+
+/* Initializes the remaining dies of the chip in `ctx`. */
+static void *dzChipInitDiesWorker(void *ctx);
 
 /* Public Functions =======================================================> */
 
@@ -70,22 +103,44 @@ dzResult dzChipInit(dzChip **chip, dzChipConfig config) {
     if (newChip == NULL) return DZ_RESULT_NO_MEMORY;
 
     {
+        // NOTE: The die configuration is owned by the caller
+        newChip->dieConfig = *(config.dieConfig);
+
         newChip->config = config;
+        newChip->config.dieConfig = &(newChip->dieConfig);
+
+        // NOTE: Each die splits its own stream off the master seed
+        newChip->dieConfig.seed = config.seed;
+
+        newChip->dies = calloc(config.dieCount, sizeof *(newChip->dies));
+    }
 
-        newChip->dies = malloc(config.dieCount * sizeof *(newChip->dies));
+    if (newChip->dies == NULL) {
+        free(newChip);
 
-        for (dzU32 i = 0; i < config.dieCount; i++) {
-            config.dieConfig->dieId = i;
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    {
+        dzU32 threadCount = config.threadCount;
 
-            if (dzDieInit(&(newChip->dies[i]), *(config.dieConfig))
-                != DZ_RESULT_OK) {
-                free(newChip->dies), free(newChip);
+        if (threadCount == 0U) {
+            long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
 
-                return DZ_RESULT_INTERNAL_ERROR;
-            }
+            threadCount = (processorCount > 0) ? (dzU32) processorCount : 1U;
         }
 
-        newChip->isReady = true;
+        if (threadCount > config.dieCount) threadCount = config.dieCount;
+
+        dzChipInitDies(newChip, threadCount);
+    }
+
+    for (dzU32 i = 0; i < config.dieCount; i++) {
+        if (newChip->dies[i] != NULL) continue;
+
+        dzChipDeinit(newChip);
+
+        return DZ_RESULT_INTERNAL_ERROR;
     }
 
     *chip = newChip;
@@ -97,8 +152,195 @@ dzResult dzChipInit(dzChip **chip, dzChipConfig config) {
 void dzChipDeinit(dzChip *chip) {
     if (chip == NULL) return;
 
-    for (dzU32 i = 0; i < chip->config.dieCount; i++)
-        dzDieDeinit(chip->dies[i]);
+    if (chip->dies != NULL)
+        for (dzU32 i = 0; i < chip->config.dieCount; i++)
+            dzDieDeinit(chip->dies[i]);
 
     free(chip->dies), free(chip);
 }
+
+/* Initializes `*chip` from the snapshot file at `path`. */
+dzResult dzChipLoad(dzChip **chip, const char *path) {
+    if (chip == NULL || path == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    FILE *stream = fopen(path, "rb");
+
+    if (stream == NULL) return DZ_RESULT_IO_ERROR;
+
+    (void) setvbuf(stream, NULL, _IOFBF, DZ_CHIP_SNAPSHOT_BUFFER_SIZE);
+
+    dzChipSnapshotHeader header;
+
+    if (fread(&header, sizeof header, 1U, stream) != 1U) {
+        (void) fclose(stream);
+
+        return DZ_RESULT_IO_ERROR;
+    }
+
+    if (memcmp(header.magic, DZ_CHIP_SNAPSHOT_MAGIC, sizeof header.magic) != 0
+        || header.version != DZ_CHIP_SNAPSHOT_VERSION
+        || header.chipId == DZ_CHIP_INVALID_ID || header.dieCount == 0U) {
+        (void) fclose(stream);
+
+        return DZ_RESULT_INVALID_IMAGE;
+    }
+
+    dzChip *newChip = malloc(sizeof *newChip);
+
+    if (newChip == NULL) {
+        (void) fclose(stream);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    {
+        // NOTE: The original die configuration is owned by the caller
+        newChip->config = (dzChipConfig) { .dieConfig = NULL,
+                                           .chipId = header.chipId,
+                                           .dieCount = header.dieCount };
+
+        newChip->dies = calloc(header.dieCount, sizeof *(newChip->dies));
+    }
+
+    if (newChip->dies == NULL) {
+        (void) fclose(stream), free(newChip);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    for (dzU32 i = 0; i < header.dieCount; i++) {
+        dzResult result = dzDieLoad(&(newChip->dies[i]), stream);
+
+        if (result != DZ_RESULT_OK) {
+            (void) fclose(stream), dzChipDeinit(newChip);
+
+            return result;
+        }
+    }
+
+    (void) fclose(stream);
+
+    *chip = newChip;
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Writes a snapshot of `chip` to the file at `path`, 
+    including the page data if `withPayload` is `true`.
+*/
+dzResult dzChipSave(const dzChip *chip, const char *path, dzBool withPayload) {
+    if (chip == NULL || path == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    FILE *stream = fopen(path, "wb");
+
+    if (stream == NULL) return DZ_RESULT_IO_ERROR;
+
+    (void) setvbuf(stream, NULL, _IOFBF, DZ_CHIP_SNAPSHOT_BUFFER_SIZE);
+
+    dzChipSnapshotHeader header = { .version = DZ_CHIP_SNAPSHOT_VERSION,
+                                    .dieCount = chip->config.dieCount,
+                                    .chipId = chip->config.chipId };
+
+    (void) memcpy(header.magic, DZ_CHIP_SNAPSHOT_MAGIC, sizeof header.magic);
+
+    dzResult result = DZ_RESULT_OK;
+
+    if (fwrite(&header, sizeof header, 1U, stream) != 1U)
+        result = DZ_RESULT_IO_ERROR;
+
+    // NOTE: Each die is streamed right after the previous one
+    for (dzU32 i = 0; i < chip->config.dieCount; i++) {
+        if (result != DZ_RESULT_OK) break;
+
+        result = dzDieSave(chip->dies[i], stream, withPayload);
+    }
+
+    if (fclose(stream) != 0 && result == DZ_RESULT_OK)
+        result = DZ_RESULT_IO_ERROR;
+
+    return result;
+}
+
+/* ========================================================================> */
+
+/* Returns the `dieId`-th die in `chip`. */
+dzDie *dzChipGetDie(const dzChip *chip, dzU64 dieId) {
+    if (chip == NULL || dieId >= chip->config.dieCount) return NULL;
+
+    return chip->dies[dieId];
+}
+
+/* Returns the number of dies in `chip`. */
+dzU32 dzChipGetDieCount(const dzChip *chip) {
+    return (chip != NULL) ? chip->config.dieCount : 0U;
+}
+
+/* 
+    Returns `true` if all dies in `chip` are ready at `time`, 
+    i.e. the shared R/B# signal is high.
+*/
+dzBool dzChipIsReady(const dzChip *chip, dzU64 time) {
+    if (chip == NULL) return false;
+
+    // NOTE: The R/B# outputs of all dies are wired-AND (open-drain)
+    for (dzU32 i = 0U; i < chip->config.dieCount; i++)
+        if (!dzDieIsReady(chip->dies[i], time)) return false;
+
+    return true;
+}
+
+/* Private Functions ======================================================> */
+
+/* Initializes the dies in `chip` on `threadCount` threads. */
+static void dzChipInitDies(dzChip *chip, dzU32 threadCount) {
+    dzChipInitContext ctx = { .chip = chip, .nextDieId = 0U };
+
+    pthread_t *threads = NULL;
+
+    dzU32 spawnedThreadCount = 0U;
+
+    if (threadCount > 1U)
+        threads = malloc((threadCount - 1U) * sizeof *threads);
+
+    for (; threads != NULL && spawnedThreadCount < threadCount - 1U;
+         spawnedThreadCount++)
+        if (pthread_create(&threads[spawnedThreadCount],
+                           NULL,
+                           dzChipInitDiesWorker,
+                           &ctx)
+            != 0)
+            break;
+
+    // NOTE: The calling thread takes part in the work as well
+    (void) dzChipInitDiesWorker(&ctx);
+
+    for (dzU32 i = 0U; i < spawnedThreadCount; i++)
+        (void) pthread_join(threads[i], NULL);
+
+    free(threads);
+}
+
+/* Initializes the remaining dies of the chip in `ctx`. */
+static void *dzChipInitDiesWorker(void *ctx) {
+    dzChipInitContext *initCtx = ctx;
+
+    dzChip *chip = initCtx->chip;
+
+    for (;;) {
+        dzU32 dieId = __atomic_fetch_add(&(initCtx->nextDieId),
+                                         1U,
+                                         __ATOMIC_RELAXED);
+
+        if (dieId >= chip->config.dieCount) break;
+
+        dzDieConfig dieConfig = chip->dieConfig;
+
+        dieConfig.dieId = dieId;
+
+        if (dzDieInit(&(chip->dies[dieId]), dieConfig) != DZ_RESULT_OK)
+            chip->dies[dieId] = NULL;
+    }
+
+    return NULL;
+}
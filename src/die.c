@@ -26,46 +26,70 @@
 #include <math.h>
 #include <string.h>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "ssdeez.h"
 
 /* Macros =================================================================> */
 
-#define dzDieForEachPage(dieBuffer, dieMetadata, ptrIdentifier) \
-    for (dzByte *ptrIdentifier = (dieBuffer),                   \
-                *ptrIdentifier##__LINE__ =                      \
-                    (dieBuffer)                                 \
-                    + ((dieMetadata).pageCountPerDie            \
-                       * (dieMetadata).physicalPageSize);       \
-         ptrIdentifier < ptrIdentifier##__LINE__;               \
-         ptrIdentifier += (dieMetadata).physicalPageSize)
-
-#define dzDieForEachPageInBlock(dieBuffer,                         \
-                                dieMetadata,                       \
-                                blockIndex,                        \
-                                ptrIdentifier)                     \
-    for (dzByte *ptrIdentifier =                                   \
-             (dieBuffer)                                           \
-             + ((blockIndex) * ((dieMetadata).physicalBlockSize)), \
-                *ptrIdentifier##__LINE__ =                         \
-                    (dieBuffer)                                    \
-                    + (((blockIndex) + 1U)                         \
-                       * ((dieMetadata).physicalBlockSize));       \
-         ptrIdentifier < ptrIdentifier##__LINE__;                  \
-         ptrIdentifier += (dieMetadata).physicalPageSize)
+#define dzDieForEachPageInBlock(die, blockIndex, indexIdentifier)            \
+    for (dzU64 indexIdentifier = (blockIndex)                                \
+                                 * (die)->config.pageCountPerBlock,          \
+               indexIdentifier##__LINE__ = indexIdentifier                   \
+                                           + (die)->config                   \
+                                                 .pageCountPerBlock;         \
+         indexIdentifier < indexIdentifier##__LINE__;                        \
+         indexIdentifier++)
 
 /* Typedefs ===============================================================> */
 
+/* 
+    A structure that represents the reference-counted data of a page, 
+    along with the erase count of its block when it was written.
+*/
+typedef struct dzDiePageData_ {
+    dzU64 refCount;
+    dzU64 eraseCount;
+    dzByte data[];
+} dzDiePageData;
+
+/* A structure that represents the reference-counted page table of a block. */
+typedef struct dzDiePageTable_ {
+    dzU64 refCount;
+    dzDiePageData *pages[];
+} dzDiePageTable;
+
 /* A structure that represents the metadata of a NAND flash die. */
 struct dzDieMetadata_ {
     dzPlaneMetadata *planes;
     dzBlockMetadata *blocks;
+    dzPageMetadata *pages;
+    dzByte *pageArrays;
+    dzByte *stateMaps;
     dzU64 blockCountPerDie;
     dzU64 pageCountPerDie;
     dzU64 pageCountPerPlane;
-    dzU32 physicalBlockSize;
-    dzU32 physicalPageSize;
 };
 
+/* 
+    A structure that represents the data buffer of a NAND flash die, 
+    backed by a two-level page table, a (mapped) image file 
+    or an array of page fingerprints.
+*/
+typedef struct dzDieBuffer_ {
+    dzDiePageTable **pageTables;
+    dzByte *pageData;
+    dzU64 *fingerprints;
+    dzByte *image;
+    dzByte *erasedPage;
+    dzUSize imageSize;
+    dzU64 residentPageCount;
+    dzU64 eraseGeneration;
+} dzDieBuffer;
+
 /* A structure that represents various statistics of a NAND flash die. */
 struct dzDieStatistics_ {
     dzF64 totalProgramLatency;
@@ -77,18 +101,83 @@ struct dzDieStatistics_ {
     // TODO: ...
 };
 
+/* 
+    A structure that represents the busy timeline of a NAND flash die, 
+    its planes and its cache register, in nanoseconds.
+*/
+typedef struct dzDieTimeline_ {
+    dzU64 *planeReadyTimes;
+    dzU64 *planeBusyTimes;
+    dzU64 readyTime;
+    dzU64 busyTime;
+    dzU64 cacheReadyTime;  // R/B#
+    dzU64 resumeTime;
+    dzSimOp *activeOp;
+} dzDieTimeline;
+
 /* A structure that represents a NAND flash die. */
 struct dzDie_ {
     dzDieConfig config;
     dzDieStatistics stats;
     dzDieMetadata metadata;
-    dzByte *buffer;
+    dzDieBuffer buffer;
+    dzDieTimeline timeline;
+    dzRng rng;
+    dzF64 lastLatency;
     dzByte status;
     // TODO: ...
 };
 
+/* A structure that represents the header of a die image file. */
+typedef struct dzDieImageHeader_ {
+    dzByte magic[8];
+    dzU32 layoutVersion;
+    dzU32 isDirty;
+    dzU64 headerSize;
+    dzDieConfig config;
+    dzDieStatistics stats;
+    dzRng rng;
+    dzU64 pageArraysOffset;
+    dzU64 stateOffset;
+    dzU64 bufferOffset;
+    dzU64 imageSize;
+} dzDieImageHeader;
+
+/* A structure that represents the header of a die snapshot. */
+typedef struct dzDieSnapshotHeader_ {
+    dzByte magic[8];
+    dzU32 version;
+    dzU32 hasPayload;
+    dzU64 headerSize;
+    dzDieConfig config;
+    dzDieStatistics stats;
+    dzRng rng;
+    dzU64 pageArraysSize;
+    dzU64 stateSize;
+    dzU64 payloadPageCount;
+} dzDieSnapshotHeader;
+
 /* Constants ==============================================================> */
 
+/* The magic number of a die image file. */
+static const dzByte DZ_DIE_IMAGE_MAGIC[8] = { 'S', 'S', 'D', 'E',
+                                              'E', 'Z', 'D', 'I' };
+
+/* The current layout version of a die image file. */
+static const dzU32 DZ_DIE_IMAGE_LAYOUT_VERSION = 6U;
+
+/* The alignment of each section within a die image file, in bytes. */
+static const dzU64 DZ_DIE_IMAGE_SECTION_ALIGNMENT = 4096U;
+
+/* The magic number of a die snapshot. */
+static const dzByte DZ_DIE_SNAPSHOT_MAGIC[8] = { 'S', 'S', 'D', 'E',
+                                                 'E', 'Z', 'D', 'S' };
+
+/* The current version of a die snapshot. */
+static const dzU32 DZ_DIE_SNAPSHOT_VERSION = 6U;
+
+/* ========================================================================> */
+
 /* A constant that represents an invalid die identifier. */
 const dzU64 DZ_DIE_INVALID_ID = UINT64_MAX;
 
@@ -98,11 +187,86 @@ const dzU64 DZ_DIE_INVALID_ID = UINT64_MAX;
 
 /* Private Function Prototypes ============================================> */
 
+/* 
+    Initializes `*die` with the given `config`, backed by 
+    a new image file at `path` unless `path` is `NULL`.
+*/
+static dzResult dzDieInitWithImage(dzDie **die,
+                                   dzDieConfig config,
+                                   const char *path);
+
+/* Creates a new `die` with the given `config`, without any metadata. */
+static dzDie *dzDieCreate(dzDieConfig config);
+
 /* Mark a random number of blocks as bad. */
 static bool dzDieCorruptRandomBlocks(dzDie *die);
 
-/* Creates a die buffer with the given `config` and `metadata`. */
-static dzByte *dzDieCreateBuffer(dzDieConfig config, dzDieMetadata metadata);
+/* Creates the page metadata arrays and the page table of `die`. */
+static bool dzDieCreateBuffer(dzDie *die);
+
+/* Releases the page metadata arrays and the page table of `die`. */
+static void dzDieDeleteBuffer(dzDie *die);
+
+/* 
+    Creates the page metadata arrays and the page data of `die` 
+    within a new image file at `path`.
+*/
+static bool dzDieCreateImageBuffer(dzDie *die, const char *path);
+
+/* Points the buffer of `die` to the mapped `image`. */
+static void dzDieAttachImage(dzDie *die,
+                             dzByte *image,
+                             const dzDieImageHeader *header);
+
+/* Computes the image file layout of `die`, and stores it in `header`. */
+static void dzDieInitImageHeader(const dzDie *die, dzDieImageHeader *header);
+
+/* Writes the current state of `die` back to its image file. */
+static bool dzDieSyncImage(dzDie *die);
+
+/* Returns the size of the state of all planes and blocks in `die`. */
+static dzU64 dzDieGetStateSize(const dzDie *die);
+
+/* Reads the page data of `die` from the snapshot in `stream`. */
+static dzResult dzDieLoadPayload(dzDie *die,
+                                 FILE *stream,
+                                 const dzDieSnapshotHeader *header);
+
+/* Writes the page data of `die` to the snapshot in `stream`. */
+static dzResult dzDieSavePayload(const dzDie *die,
+                                 FILE *stream,
+                                 const dzDieSnapshotHeader *header);
+
+/* Reads the state of all planes and blocks in `die` from `src`. */
+static bool dzDieReadState(dzDie *die, dzByteStream *src);
+
+/* Writes the state of all planes and blocks in `die` to `dst`. */
+static bool dzDieWriteState(const dzDie *die, dzByteStream *dst);
+
+/* 
+    Returns the pointer to the data of the `pageId`-th page 
+    in the `blockIndex`-th block, allocating it on demand.
+    The contents of the page are undefined until written.
+*/
+static dzByte *dzDieAllocPageData(dzDie *die, dzU64 blockIndex, dzU64 pageId);
+
+/* 
+    Returns the page table of the `blockIndex`-th block in `die`, 
+    allocating it on demand, or copying it if it is shared.
+*/
+static dzDiePageTable *dzDieGetPrivatePageTable(dzDie *die, dzU64 blockIndex);
+
+/* Releases a reference to `pageTable` with `pageCount` entries. */
+static void dzDieReleasePageTable(dzDiePageTable *pageTable, dzU64 pageCount);
+
+/* Releases a reference to `pageData`. */
+static void dzDieReleasePageData(dzDiePageData *pageData);
+
+/* 
+    Returns the pointer to a page of `die` in the erased state, 
+    allocating it on demand.
+*/
+static const dzByte *dzDieGetErasedPage(dzDie *die);
 
 /* 
     Returns the previous or the next index of 
@@ -119,19 +283,77 @@ static bool dzDieInitPlaneMetadata(dzDie *die);
 /* Initializes a `die` metadata. */
 static bool dzDieInitMetadata(dzDie *die);
 
+/* Initializes all page metadata in `die.` */
+static bool dzDieInitPageMetadata(dzDie *die);
+
 /* Writes the contents of the ONFI parameter page to `die`. */
 static bool dzDieProgramParameterPage(dzDie *die);
 
+/* 
+    Writes `srcs[i].ptr` to the page corresponding to `ppas[i]` in `die`, 
+    for each of the `count` pages in the same block, and stores the result 
+    of each write in `results[i]`.
+*/
+static void dzDieProgramRun(dzDie *die,
+                            const dzPPA *ppas,
+                            const dzByteArray *srcs,
+                            dzResult *results,
+                            dzU64 count);
+
+/* 
+    Reads data from the page corresponding to `ppas[i]` in `die`, 
+    and copies it to `dsts[i].ptr`, for each of the `count` pages 
+    in the same block, and stores the result of each read in `results[i]`.
+*/
+static void dzDieReadRun(dzDie *die,
+                         const dzPPA *ppas,
+                         const dzByteArray *dsts,
+                         dzResult *results,
+                         dzU64 count);
+
+/* 
+    Senses the `pageIndex`-th page of `die` into its page register, 
+    and updates the latency statistics of `die`.
+*/
+static dzResult dzDieSensePage(dzDie *die, dzU64 pageIndex);
+
 /* ========================================================================> */
 
 /* Returns the pointer to the `blockIndex`-th block metadata. */
 DZ_API_STATIC_INLINE dzBlockMetadata *dzDieGetBlockMetadata(const dzDie *die,
                                                             dzU64 blockIndex);
 
+/* Returns `true` if `refCount` is shared with other dies. */
+DZ_API_STATIC_INLINE dzBool dzDieIsShared(dzU64 *refCount);
+
+/* 
+    Returns the first of the `count` results in `results` 
+    that is not `DZ_RESULT_OK`, or `DZ_RESULT_OK` if there is none.
+*/
+DZ_API_STATIC_INLINE dzResult dzDieGetFirstError(const dzResult *results,
+                                                 dzU64 count);
+
+/* 
+    Returns the number of leading addresses among the `count` addresses 
+    in `ppas` that point to the same block.
+*/
+DZ_API_STATIC_INLINE dzU64 dzDieGetRunLength(const dzPPA *ppas, dzU64 count);
+
+/* Acquires a new reference to `refCount`. */
+DZ_API_STATIC_INLINE void dzDieRetain(dzU64 *refCount);
+
 /* Returns the pointer to the `planeIndex`-th plane metadata. */
 DZ_API_STATIC_INLINE dzPlaneMetadata *dzDieGetPlaneMetadata(const dzDie *die,
                                                             dzU64 planeIndex);
 
+/* 
+    Returns the pointer to the data of the `pageId`-th page 
+    in the `blockIndex`-th block, or `NULL` if it is not resident.
+*/
+DZ_API_STATIC_INLINE dzByte *dzDieGetPageData(const dzDie *die,
+                                              dzU64 blockIndex,
+                                              dzU64 pageId);
+
 /* Returns an invalid physical page address. */
 DZ_API_STATIC_INLINE dzPPA dzDieGetInvalidPPA(void);
 
@@ -147,68 +369,350 @@ DZ_API_STATIC_INLINE dzBool dzDieIsValidPBA(const dzDie *die, dzPBA pba);
 */
 DZ_API_STATIC_INLINE dzBool dzDieIsValidPPA(const dzDie *die, dzPPA ppa);
 
-/* Returns the pointer to a page corresponding to `ppa` in `die`. */
-DZ_API_STATIC_INLINE dzByte *dzDiePPAToPtr(const dzDie *die, dzPPA ppa);
+/* 
+    Returns `true` if `ppas` are `count` page (or block, if `isPageOp` 
+    is `false`) addresses within `die` that can be accessed with 
+    a single multi-plane operation.
+*/
+DZ_API_STATIC_INLINE dzBool dzDieIsValidMultiPlaneOp(const dzDie *die,
+                                                     const dzPPA *ppas,
+                                                     dzU64 count,
+                                                     dzBool isPageOp);
+
+/* Returns `true` if `config` is a valid die configuration. */
+DZ_API_STATIC_INLINE dzBool dzDieIsValidConfig(dzDieConfig config);
+
+/* 
+    Returns the fraction of the time until `time` spent busy, 
+    given the total `busyTime` and the current `readyTime`.
+*/
+DZ_API_STATIC_INLINE dzF64 dzDieComputeUtilization(dzU64 busyTime,
+                                                   dzU64 readyTime,
+                                                   dzU64 time);
+
+/* Returns `offset` rounded up to the image section alignment. */
+DZ_API_STATIC_INLINE dzU64 dzDieAlignImageOffset(dzU64 offset);
+
+/* Returns the index of the block corresponding to `pba` in `die`. */
+DZ_API_STATIC_INLINE dzU64 dzDiePBAToBlockIndex(const dzDie *die, dzPBA pba);
+
+/* Returns the index of the page corresponding to `ppa` in `die`. */
+DZ_API_STATIC_INLINE dzU64 dzDiePPAToPageIndex(const dzDie *die, dzPPA ppa);
 
 /* Public Functions =======================================================> */
 
 /* Initializes `*die` with the given `config`. */
 dzResult dzDieInit(dzDie **die, dzDieConfig config) {
-    // clang-format off
+    return dzDieInitWithImage(die, config, NULL);
+}
 
-    if (die == NULL
-        || config.dieId == DZ_DIE_INVALID_ID
-        || config.cellType <= DZ_CELL_TYPE_UNKNOWN
-        || config.cellType >= DZ_CELL_TYPE_COUNT_
-        || config.planeCountPerDie == 0U 
-        || config.blockCountPerPlane == 0U
-        || config.pageCountPerBlock == 0U
-        || (config.pageCountPerBlock % 32U) != 0U
-        || config.pageSizeInBytes == 0U)
-        return DZ_RESULT_INVALID_ARGUMENT;
+/* 
+    Initializes `*die` with the given `config`, 
+    backed by a new image file at `path`.
+*/
+dzResult dzDieCreateImage(dzDie **die, dzDieConfig config, const char *path) {
+    if (path == NULL) return DZ_RESULT_INVALID_ARGUMENT;
 
-    // clang-format on
+    return dzDieInitWithImage(die, config, path);
+}
 
-    dzDie *newDie = malloc(sizeof *newDie);
+/* Initializes `*die` from the existing image file at `path`. */
+dzResult dzDieOpenImage(dzDie **die, const char *path) {
+    if (die == NULL || path == NULL) return DZ_RESULT_INVALID_ARGUMENT;
 
-    if (newDie == NULL) return DZ_RESULT_NO_MEMORY;
+    int fd = open(path, O_RDWR);
+
+    if (fd < 0) return DZ_RESULT_IO_ERROR;
+
+    dzDieImageHeader header;
 
     {
-        newDie->config = config;
+        struct stat fileStat;
 
-        newDie->stats = (dzDieStatistics) { .totalProgramLatency = 0.0,
-                                            .totalProgramCount = 0U,
-                                            .totalReadLatency = 0.0,
-                                            .totalReadCount = 0U,
-                                            .totalEraseLatency = 0.0,
-                                            .totalEraseCount = 0U };
+        if (fstat(fd, &fileStat) != 0
+            || pread(fd, &header, sizeof header, 0)
+                   != (ssize_t) sizeof header) {
+            (void) close(fd);
+
+            return DZ_RESULT_IO_ERROR;
+        }
+
+        // clang-format off
+
+        // NOTE: Images that were not closed properly are also rejected
+        if (memcmp(header.magic, DZ_DIE_IMAGE_MAGIC, sizeof header.magic) != 0
+            || header.layoutVersion != DZ_DIE_IMAGE_LAYOUT_VERSION
+            || header.headerSize != sizeof header
+            || header.isDirty != 0U
+            || header.imageSize != (dzU64) fileStat.st_size
+            || !dzDieIsValidConfig(header.config)) {
+            (void) close(fd);
+
+            return DZ_RESULT_INVALID_IMAGE;
+        }
+
+        // clang-format on
+    }
+
+    dzDie *newDie = dzDieCreate(header.config);
+
+    if (newDie == NULL) {
+        (void) close(fd);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    newDie->stats = header.stats;
+    newDie->rng = header.rng;
+
+    if (!dzDieInitMetadata(newDie)) {
+        (void) close(fd), dzDieDeinit(newDie);
+
+        return DZ_RESULT_INVALID_METADATA;
+    }
+
+    {
+        dzDieImageHeader expectedHeader;
+
+        dzDieInitImageHeader(newDie, &expectedHeader);
+
+        if (header.pageArraysOffset != expectedHeader.pageArraysOffset
+            || header.stateOffset != expectedHeader.stateOffset
+            || header.bufferOffset != expectedHeader.bufferOffset
+            || header.imageSize != expectedHeader.imageSize) {
+            (void) close(fd), dzDieDeinit(newDie);
+
+            return DZ_RESULT_INVALID_IMAGE;
+        }
+    }
+
+    dzByte *image = mmap(NULL,
+                         header.imageSize,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED,
+                         fd,
+                         0);
+
+    (void) close(fd);
 
-        newDie->metadata = (dzDieMetadata) { .planes = NULL, .blocks = NULL };
+    if (image == MAP_FAILED) {
+        dzDieDeinit(newDie);
+
+        return DZ_RESULT_IO_ERROR;
+    }
+
+    dzPageConfig pageConfig = { .pageCount = newDie->metadata.pageCountPerDie,
+                                .cellType = newDie->config.cellType };
+
+    dzByteStream src = { .ptr = image + header.stateOffset,
+                         .size = header.bufferOffset - header.stateOffset,
+                         .offset = 0U };
+
+    if (!dzDieReadState(newDie, &src)
+        || dzPageLoadMetadata(newDie->metadata.pages,
+                              image + header.pageArraysOffset,
+                              pageConfig)
+               != DZ_RESULT_OK) {
+        (void) munmap(image, header.imageSize), dzDieDeinit(newDie);
+
+        return DZ_RESULT_INVALID_IMAGE;
     }
 
+    dzDieAttachImage(newDie, image, &header);
+
+    *die = newDie;
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Initializes `*die` as a copy-on-write clone of `parent`, 
+    sharing the page data of `parent` until either of them modifies it.
+*/
+dzResult dzDieClone(dzDie **die, const dzDie *parent) {
+    if (die == NULL || parent == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: Image-backed dies cannot share their mapped page data
+    if (parent->buffer.image != NULL) return DZ_RESULT_INVALID_STATE;
+
+    dzDie *newDie = dzDieCreate(parent->config);
+
+    if (newDie == NULL) return DZ_RESULT_NO_MEMORY;
+
+    newDie->stats = parent->stats;
+
+    // NOTE: The clone continues on a stream that never overlaps its parent's
+    newDie->rng = parent->rng;
+
+    dzUtilsRngLongJump(&(newDie->rng));
+
     if (!dzDieInitMetadata(newDie)) {
         dzDieDeinit(newDie);
 
         return DZ_RESULT_INVALID_METADATA;
     }
 
-    if ((newDie->buffer = dzDieCreateBuffer(config, newDie->metadata))
-        == NULL) {
+    if (!dzDieCreateBuffer(newDie)) {
         dzDieDeinit(newDie);
 
         return DZ_RESULT_NO_MEMORY;
     }
 
-    if (!dzDieCorruptRandomBlocks(newDie)) {
+    dzResult result = DZ_RESULT_OK;
+
+    {
+        dzU64 stateSize = dzDieGetStateSize(parent);
+
+        dzByteStream stream = { .ptr = malloc(stateSize),
+                                .size = stateSize,
+                                .offset = 0U };
+
+        dzPageConfig pageConfig = {
+            .pageCount = newDie->metadata.pageCountPerDie,
+            .cellType = newDie->config.cellType
+        };
+
+        /* 
+            NOTE: Metadata of all pages, blocks and planes are copied eagerly, 
+                  since they are much smaller than the page data
+        */
+        (void) memcpy(newDie->metadata.pageArrays,
+                      parent->metadata.pageArrays,
+                      dzPageGetArrayRegionSize(
+                          newDie->metadata.pageCountPerDie));
+
+        if (stream.ptr == NULL) {
+            result = DZ_RESULT_NO_MEMORY;
+        } else if (dzDieWriteState(parent, &stream)) {
+            stream.offset = 0U;
+
+            if (!dzDieReadState(newDie, &stream)
+                || dzPageLoadMetadata(newDie->metadata.pages,
+                                      newDie->metadata.pageArrays,
+                                      pageConfig)
+                       != DZ_RESULT_OK)
+                result = DZ_RESULT_INVALID_METADATA;
+        } else {
+            result = DZ_RESULT_INVALID_METADATA;
+        }
+
+        free(stream.ptr);
+    }
+
+    if (result != DZ_RESULT_OK) {
         dzDieDeinit(newDie);
 
-        return DZ_RESULT_INJECTION_FAILED;
+        return result;
     }
 
-    if (!dzDieProgramParameterPage(newDie)) {
+    if (parent->buffer.pageTables != NULL) {
+        // NOTE: Page tables are shared, and copied on the first write
+        for (dzU64 i = 0U; i < parent->metadata.blockCountPerDie; i++) {
+            dzDiePageTable *pageTable = parent->buffer.pageTables[i];
+
+            if (pageTable != NULL) dzDieRetain(&pageTable->refCount);
+
+            newDie->buffer.pageTables[i] = pageTable;
+        }
+
+        newDie->buffer.residentPageCount = parent->buffer.residentPageCount;
+    } else if (parent->buffer.fingerprints != NULL) {
+        (void) memcpy(newDie->buffer.fingerprints,
+                      parent->buffer.fingerprints,
+                      parent->metadata.pageCountPerDie
+                          * sizeof *(parent->buffer.fingerprints));
+    }
+
+    *die = newDie;
+
+    return DZ_RESULT_OK;
+}
+
+/* Initializes `*die` from the snapshot read from `stream`. */
+dzResult dzDieLoad(dzDie **die, FILE *stream) {
+    if (die == NULL || stream == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzDieSnapshotHeader header;
+
+    if (fread(&header, sizeof header, 1U, stream) != 1U)
+        return DZ_RESULT_IO_ERROR;
+
+    // clang-format off
+
+    if (memcmp(header.magic, DZ_DIE_SNAPSHOT_MAGIC, sizeof header.magic) != 0
+        || header.version != DZ_DIE_SNAPSHOT_VERSION
+        || header.headerSize != sizeof header
+        || !dzDieIsValidConfig(header.config))
+        return DZ_RESULT_INVALID_IMAGE;
+
+    // clang-format on
+
+    dzDie *newDie = dzDieCreate(header.config);
+
+    if (newDie == NULL) return DZ_RESULT_NO_MEMORY;
+
+    newDie->stats = header.stats;
+    newDie->rng = header.rng;
+
+    if (!dzDieInitMetadata(newDie)) {
         dzDieDeinit(newDie);
 
-        return DZ_RESULT_INTERNAL_ERROR;
+        return DZ_RESULT_INVALID_METADATA;
+    }
+
+    if (header.pageArraysSize
+            != dzPageGetArrayRegionSize(newDie->metadata.pageCountPerDie)
+        || header.stateSize != dzDieGetStateSize(newDie)) {
+        dzDieDeinit(newDie);
+
+        return DZ_RESULT_INVALID_IMAGE;
+    }
+
+    if (!dzDieCreateBuffer(newDie)) {
+        dzDieDeinit(newDie);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    dzResult result = DZ_RESULT_OK;
+
+    {
+        dzByteStream src = { .ptr = malloc(header.stateSize),
+                             .size = header.stateSize,
+                             .offset = 0U };
+
+        dzPageConfig pageConfig = {
+            .pageCount = newDie->metadata.pageCountPerDie,
+            .cellType = newDie->config.cellType
+        };
+
+        // NOTE: Page metadata arrays are restored with a single bulk read
+        if (src.ptr == NULL)
+            result = DZ_RESULT_NO_MEMORY;
+        else if (fread(newDie->metadata.pageArrays,
+                       header.pageArraysSize,
+                       1U,
+                       stream)
+                     != 1U
+                 || fread(src.ptr, header.stateSize, 1U, stream) != 1U)
+            result = DZ_RESULT_IO_ERROR;
+        else if (!dzDieReadState(newDie, &src)
+                 || dzPageLoadMetadata(newDie->metadata.pages,
+                                       newDie->metadata.pageArrays,
+                                       pageConfig)
+                        != DZ_RESULT_OK)
+            result = DZ_RESULT_INVALID_IMAGE;
+
+        free(src.ptr);
+    }
+
+    if (result == DZ_RESULT_OK)
+        result = dzDieLoadPayload(newDie, stream, &header);
+
+    if (result != DZ_RESULT_OK) {
+        dzDieDeinit(newDie);
+
+        return result;
     }
 
     *die = newDie;
@@ -216,27 +720,84 @@ dzResult dzDieInit(dzDie **die, dzDieConfig config) {
     return DZ_RESULT_OK;
 }
 
-/* Releases the memory allocated for `die`. */
-void dzDieDeinit(dzDie *die) {
-    if (die == NULL) return;
+/* 
+    Writes a snapshot of `die` to `stream`, 
+    including the page data if `withPayload` is `true`.
+*/
+dzResult dzDieSave(const dzDie *die, FILE *stream, dzBool withPayload) {
+    if (die == NULL || stream == NULL) return DZ_RESULT_INVALID_ARGUMENT;
 
-    for (dzU64 i = 0U; i < die->metadata.blockCountPerDie; i++) {
-        dzBlockMetadata *blockMetadata =
-            (dzBlockMetadata *) (((dzByte *) die->metadata.blocks)
-                                 + (i * dzBlockGetMetadataSize()));
+    dzDieSnapshotHeader header;
+
+    {
+        (void) memset(&header, 0, sizeof header);
+
+        (void) memcpy(header.magic,
+                      DZ_DIE_SNAPSHOT_MAGIC,
+                      sizeof header.magic);
 
-        dzBlockDeinitMetadata(blockMetadata);
+        header.version = DZ_DIE_SNAPSHOT_VERSION;
+        header.hasPayload = withPayload;
+        header.headerSize = sizeof header;
+
+        header.config = die->config;
+        header.stats = die->stats;
+        header.rng = die->rng;
+
+        header.pageArraysSize =
+            dzPageGetArrayRegionSize(die->metadata.pageCountPerDie);
+        header.stateSize = dzDieGetStateSize(die);
     }
 
-    for (dzU64 i = 0U; i < die->config.planeCountPerDie; i++) {
-        dzPlaneMetadata *planeMetadata =
-            (dzPlaneMetadata *) (((dzByte *) die->metadata.planes)
-                                 + (i * dzPlaneGetMetadataSize()));
+    if (withPayload && die->config.dataMode == DZ_DIE_DATA_MODE_FULL) {
+        for (dzU64 i = 0U; i < die->metadata.pageCountPerDie; i++) {
+            dzU64 blockIndex = i / die->config.pageCountPerBlock;
+            dzU64 pageId = i % die->config.pageCountPerBlock;
 
-        dzPlaneDeinitMetadata(planeMetadata);
+            // NOTE: Free pages are always restored in the 'erased' state
+            if (dzPageGetState(die->metadata.pages, i) != DZ_PAGE_STATE_FREE
+                && dzDieGetPageData(die, blockIndex, pageId) != NULL)
+                header.payloadPageCount++;
+        }
     }
 
-    free(die->metadata.planes), free(die->buffer), free(die);
+    dzByteStream dst = { .ptr = malloc(header.stateSize),
+                         .size = header.stateSize,
+                         .offset = 0U };
+
+    if (dst.ptr == NULL) return DZ_RESULT_NO_MEMORY;
+
+    dzResult result = DZ_RESULT_OK;
+
+    if (!dzDieWriteState(die, &dst))
+        result = DZ_RESULT_INTERNAL_ERROR;
+    else if (fwrite(&header, sizeof header, 1U, stream) != 1U
+             || fwrite(die->metadata.pageArrays,
+                       header.pageArraysSize,
+                       1U,
+                       stream)
+                    != 1U
+             || fwrite(dst.ptr, header.stateSize, 1U, stream) != 1U)
+        result = DZ_RESULT_IO_ERROR;
+    else
+        result = dzDieSavePayload(die, stream, &header);
+
+    free(dst.ptr);
+
+    return result;
+}
+
+/* Releases the memory allocated for `die`. */
+void dzDieDeinit(dzDie *die) {
+    if (die == NULL) return;
+
+    if (die->buffer.image != NULL) (void) dzDieSyncImage(die);
+
+    dzDieDeleteBuffer(die);
+
+    free(die->timeline.planeReadyTimes);
+
+    free(die->metadata.planes), free(die);
 }
 
 /* Returns the configuration of `die`. */
@@ -261,8 +822,7 @@ dzU64 dzDieGetBlockCount(const dzDie *die) {
 dzBlockState dzDieGetBlockState(const dzDie *die, dzPBA pba) {
     if (!dzDieIsValidPBA(die, pba)) return DZ_BLOCK_STATE_UNKNOWN;
 
-    dzU64 blockIndex = (pba.planeId * die->config.blockCountPerPlane)
-                       + pba.blockId;
+    dzU64 blockIndex = dzDiePBAToBlockIndex(die, pba);
 
     const dzBlockMetadata *blockMetadata =
         (const dzBlockMetadata *) (((dzByte *) die->metadata.blocks)
@@ -287,7 +847,8 @@ dzF64 dzDieGetMaxEraseLatency(const dzDie *die) {
 
 /* Returns the first physical block address within `die`. */
 dzPBA dzDieGetFirstPBA(const dzDie *die) {
-    return (dzPBA) { .chipId = DZ_CHIP_INVALID_ID,
+    return (dzPBA) { .channelId = DZ_CHANNEL_INVALID_ID,
+                     .chipId = DZ_CHIP_INVALID_ID,
                      .dieId = ((die != NULL) ? die->config.dieId
                                              : DZ_DIE_INVALID_ID),
                      .planeId = ((die != NULL) ? 0U : DZ_PLANE_INVALID_ID),
@@ -296,7 +857,8 @@ dzPBA dzDieGetFirstPBA(const dzDie *die) {
 
 /* Returns the first physical page address within `die`. */
 dzPPA dzDieGetFirstPPA(const dzDie *die) {
-    return (dzPPA) { .chipId = DZ_CHIP_INVALID_ID,
+    return (dzPPA) { .channelId = DZ_CHANNEL_INVALID_ID,
+                     .chipId = DZ_CHIP_INVALID_ID,
                      .dieId = ((die != NULL) ? die->config.dieId
                                              : DZ_DIE_INVALID_ID),
                      .planeId = ((die != NULL) ? 0U : DZ_PLANE_INVALID_ID),
@@ -335,30 +897,29 @@ dzPPA dzDieGetNextPPA(const dzDie *die, dzPPA ppa) {
 
 /* ========================================================================> */
 
+/* 
+    Returns the latency of the last program, read or erase operation 
+    on `die`, in milliseconds.
+*/
+dzF64 dzDieGetLastLatency(const dzDie *die) {
+    return (die != NULL) ? die->lastLatency : 0.0;
+}
+
 /* Returns the maximum P/E cycles among all pages within `die`. */
 dzU32 dzDieGetMaxPeCycles(const dzDie *die) {
     if (die == NULL) return 0U;
 
-    dzU32 result = 0U;
-
-    dzDieForEachPage(die->buffer, die->metadata, pagePtr) {
-        dzU32 maxPeCycles = dzPageGetMaxPeCycles(pagePtr,
-                                                 die->config.pageSizeInBytes);
-
-        if (result < maxPeCycles) result = maxPeCycles;
-    }
-
-    return result;
-}
+    return dzPageGetMaxPeCyclesInRange(die->metadata.pages,
+                                       0U,
+                                       die->metadata.pageCountPerDie);
+}
 
 /* Returns the maximum program latency of `die`, in milliseconds. */
 dzF64 dzDieGetMaxProgramLatency(const dzDie *die) {
     dzF64 result;
 
     if (die == NULL
-        || dzPageGetMaxProgramLatency(die->buffer,
-                                      die->config.pageSizeInBytes,
-                                      &result)
+        || dzPageGetMaxProgramLatency(die->metadata.pages, &result)
                != DZ_RESULT_OK)
         return DBL_MAX;
 
@@ -370,28 +931,97 @@ dzF64 dzDieGetMaxReadLatency(const dzDie *die) {
     dzF64 result;
 
     if (die == NULL
-        || dzPageGetMaxReadLatency(die->buffer,
-                                   die->config.pageSizeInBytes,
-                                   &result)
+        || dzPageGetMaxReadLatency(die->metadata.pages, &result)
                != DZ_RESULT_OK)
         return DBL_MAX;
 
     return result;
 }
 
+/* 
+    Returns the number of invalid pages in the block 
+    corresponding to `pba` within `die`.
+*/
+dzU64 dzDieGetBlockInvalidPageCount(const dzDie *die, dzPBA pba) {
+    if (!dzDieIsValidPBA(die, pba)) return 0U;
+
+    return dzBlockGetInvalidPageCount(
+        dzDieGetBlockMetadata(die, dzDiePBAToBlockIndex(die, pba)));
+}
+
+/* 
+    Returns the number of valid pages in the block 
+    corresponding to `pba` within `die`.
+*/
+dzU64 dzDieGetBlockValidPageCount(const dzDie *die, dzPBA pba) {
+    if (!dzDieIsValidPBA(die, pba)) return 0U;
+
+    return dzBlockGetValidPageCount(
+        dzDieGetBlockMetadata(die, dzDiePBAToBlockIndex(die, pba)));
+}
+
+/* Returns the number of invalid pages in `die`. */
+dzU64 dzDieGetInvalidPageCount(const dzDie *die) {
+    if (die == NULL) return 0U;
+
+    dzU64 result = 0U;
+
+    for (dzU64 i = 0U; i < die->config.planeCountPerDie; i++)
+        result += dzPlaneGetInvalidPageCount(dzDieGetPlaneMetadata(die, i));
+
+    return result;
+}
+
 /* Returns the total number of pages in `die`. */
 dzU64 dzDieGetPageCount(const dzDie *die) {
     return (die != NULL) ? die->metadata.pageCountPerDie : 0U;
 }
 
+/* 
+    Returns the fingerprint of the data of the page 
+    corresponding to `ppa` within `die`. 
+*/
+dzResult dzDieGetPageFingerprint(const dzDie *die,
+                                 dzPPA ppa,
+                                 dzU64 *fingerprint) {
+    dzU64 pageIndex = dzDiePPAToPageIndex(die, ppa);
+
+    if (pageIndex == DZ_PAGE_INVALID_ID || fingerprint == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    if (die->config.dataMode != DZ_DIE_DATA_MODE_FINGERPRINT)
+        return DZ_RESULT_INVALID_STATE;
+
+    *fingerprint = die->buffer.fingerprints[pageIndex];
+
+    return DZ_RESULT_OK;
+}
+
 /* 
     Returns the current state of the page 
     corresponding to `ppa` within `die`. 
 */
 dzPageState dzDieGetPageState(const dzDie *die, dzPPA ppa) {
-    const dzByte *pagePtr = (const dzByte *) dzDiePPAToPtr(die, ppa);
+    if (die == NULL) return DZ_PAGE_STATE_UNKNOWN;
 
-    return dzPageGetState(pagePtr, die->config.pageSizeInBytes);
+    return dzPageGetState(die->metadata.pages, dzDiePPAToPageIndex(die, ppa));
+}
+
+/* Returns the number of pages whose data are resident in `die`. */
+dzU64 dzDieGetResidentPageCount(const dzDie *die) {
+    return (die != NULL) ? die->buffer.residentPageCount : 0U;
+}
+
+/* Returns the number of valid pages in `die`. */
+dzU64 dzDieGetValidPageCount(const dzDie *die) {
+    if (die == NULL) return 0U;
+
+    dzU64 result = 0U;
+
+    for (dzU64 i = 0U; i < die->config.planeCountPerDie; i++)
+        result += dzPlaneGetValidPageCount(dzDieGetPlaneMetadata(die, i));
+
+    return result;
 }
 
 /* ========================================================================> */
@@ -413,71 +1043,319 @@ dzU64 dzDieGetTotalEraseCount(const dzDie *die) {
 
 /* ========================================================================> */
 
+/* 
+    Returns the program or erase operation in progress on the array 
+    of `die`, or `NULL` if there is none.
+*/
+dzSimOp *dzDieGetActiveOp(const dzDie *die) {
+    return (die != NULL) ? die->timeline.activeOp : NULL;
+}
+
+/* Returns the total time that `die` has been busy, in nanoseconds. */
+dzU64 dzDieGetBusyTime(const dzDie *die) {
+    return (die != NULL) ? die->timeline.busyTime : 0U;
+}
+
+/* 
+    Returns the time at which the cache register of `die` becomes free, 
+    in nanoseconds.
+*/
+dzU64 dzDieGetCacheReadyTime(const dzDie *die) {
+    return (die != NULL) ? die->timeline.cacheReadyTime : 0U;
+}
+
+/* 
+    Returns the time it takes to transfer a page between the host 
+    and the cache register of `die`, in nanoseconds.
+*/
+dzU64 dzDieGetPageTransferTime(const dzDie *die) {
+    if (die == NULL) return 0U;
+
+    // NOTE: The spare area is transferred along with the data area
+    return ((dzU64) die->config.pageSizeInBytes + dzPageGetSpareSize())
+           * die->config.ioCycleTime;
+}
+
+/* 
+    Returns the total time that the `planeId`-th plane 
+    in `die` has been busy, in nanoseconds.
+*/
+dzU64 dzDieGetPlaneBusyTime(const dzDie *die, dzU64 planeId) {
+    return (die != NULL && planeId < die->config.planeCountPerDie)
+               ? die->timeline.planeBusyTimes[planeId]
+               : 0U;
+}
+
+/* 
+    Returns the time at which the `planeId`-th plane 
+    in `die` becomes ready, in nanoseconds.
+*/
+dzU64 dzDieGetPlaneReadyTime(const dzDie *die, dzU64 planeId) {
+    return (die != NULL && planeId < die->config.planeCountPerDie)
+               ? die->timeline.planeReadyTimes[planeId]
+               : 0U;
+}
+
+/* 
+    Returns the fraction of the time until `time` during which 
+    the `planeId`-th plane in `die` has been busy.
+*/
+dzF64 dzDieGetPlaneUtilization(const dzDie *die, dzU64 planeId, dzU64 time) {
+    if (die == NULL || planeId >= die->config.planeCountPerDie) return 0.0;
+
+    return dzDieComputeUtilization(die->timeline.planeBusyTimes[planeId],
+                                   die->timeline.planeReadyTimes[planeId],
+                                   time);
+}
+
+/* 
+    Returns the time at which the array of `die` becomes ready, 
+    in nanoseconds.
+*/
+dzU64 dzDieGetReadyTime(const dzDie *die) {
+    return (die != NULL) ? die->timeline.readyTime : 0U;
+}
+
+/* 
+    Returns the time at which the operation suspended in `die` 
+    is resumed, in nanoseconds.
+*/
+dzU64 dzDieGetResumeTime(const dzDie *die) {
+    return (die != NULL) ? die->timeline.resumeTime : 0U;
+}
+
+/* 
+    Returns the fraction of the time until `time` during which 
+    `die` has been busy.
+*/
+dzF64 dzDieGetUtilization(const dzDie *die, dzU64 time) {
+    if (die == NULL) return 0.0;
+
+    return dzDieComputeUtilization(die->timeline.busyTime,
+                                   die->timeline.readyTime,
+                                   time);
+}
+
+/* Returns `true` if `die` is ready (R/B# is high) at `time`. */
+dzBool dzDieIsReady(const dzDie *die, dzU64 time) {
+    // NOTE: R/B# goes high as soon as the cache register can accept data
+    return (die != NULL) && (die->timeline.cacheReadyTime <= time);
+}
+
+/* 
+    Marks the planes in `planeMask` of `die` as busy for `duration` 
+    nanoseconds from `startTime`, if the array is ready at `startTime`.
+*/
+dzResult dzDieMarkAsBusy(dzDie *die,
+                         dzU64 planeMask,
+                         dzU64 startTime,
+                         dzU64 duration) {
+    if (die == NULL || planeMask == 0U
+        || duration > (UINT64_MAX - startTime))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzU64 planeCount = die->config.planeCountPerDie;
+
+    if (planeCount < DZ_DIE_MAX_PLANE_COUNT
+        && (planeMask >> planeCount) != 0U)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: A die accepts no other array operation until it becomes ready
+    if (die->timeline.readyTime > startTime) return DZ_RESULT_BUSY;
+
+    dzU64 readyTime = startTime + duration;
+
+    for (dzU64 i = 0U; i < planeCount; i++) {
+        if ((planeMask & (UINT64_C(1) << i)) == 0U) continue;
+
+        die->timeline.planeReadyTimes[i] = readyTime;
+        die->timeline.planeBusyTimes[i] += duration;
+    }
+
+    die->timeline.readyTime = readyTime;
+    die->timeline.busyTime += duration;
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Marks the cache register of `die` as busy for `duration` nanoseconds 
+    from `startTime`, if it is free at `startTime`.
+*/
+dzResult dzDieMarkCacheAsBusy(dzDie *die, dzU64 startTime, dzU64 duration) {
+    if (die == NULL || duration > (UINT64_MAX - startTime))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    if (die->timeline.cacheReadyTime > startTime) return DZ_RESULT_BUSY;
+
+    die->timeline.cacheReadyTime = startTime + duration;
+
+    return DZ_RESULT_OK;
+}
+
+/* Returns the contents of the status register of `die` at `time`. */
+dzByte dzDieReadStatus(const dzDie *die, dzU64 time) {
+    if (die == NULL) return 0x00U;
+
+    dzByte status = die->status;
+
+    if (dzDieIsReady(die, time)) {
+        status |= DZ_DIE_STATUS_RDY;
+
+        // NOTE: The array may still be busy after a cache operation
+        if (die->timeline.readyTime <= time) status |= DZ_DIE_STATUS_ARDY;
+    }
+
+    return status;
+}
+
+/* 
+    Sets `op` as the program or erase operation in progress on the array 
+    of `die`, or clears it if `op` is `NULL`.
+*/
+void dzDieSetActiveOp(dzDie *die, dzSimOp *op) {
+    if (die != NULL) die->timeline.activeOp = op;
+}
+
+/* 
+    Suspends the array operation of `die` in progress at `time` 
+    for `duration` nanoseconds, during which the planes in `planeMask` 
+    are busy with another operation.
+*/
+dzResult dzDieSuspend(dzDie *die,
+                      dzU64 planeMask,
+                      dzU64 time,
+                      dzU64 duration) {
+    if (die == NULL || planeMask == 0U
+        || duration > (UINT64_MAX - die->timeline.readyTime)
+        || duration > (UINT64_MAX - die->timeline.cacheReadyTime))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzU64 planeCount = die->config.planeCountPerDie;
+
+    if (planeCount < DZ_DIE_MAX_PLANE_COUNT
+        && (planeMask >> planeCount) != 0U)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: Only one operation can be served per suspension
+    if (die->timeline.readyTime <= time || die->timeline.resumeTime > time)
+        return DZ_RESULT_BUSY;
+
+    dzU64 resumeTime = time + duration;
+
+    // NOTE: Everything that has not finished yet is pushed back
+    for (dzU64 i = 0U; i < planeCount; i++) {
+        if (die->timeline.planeReadyTimes[i] > time)
+            die->timeline.planeReadyTimes[i] += duration;
+
+        if ((planeMask & (UINT64_C(1) << i)) == 0U) continue;
+
+        if (die->timeline.planeReadyTimes[i] < resumeTime)
+            die->timeline.planeReadyTimes[i] = resumeTime;
+
+        die->timeline.planeBusyTimes[i] += duration;
+    }
+
+    if (die->timeline.cacheReadyTime > time)
+        die->timeline.cacheReadyTime += duration;
+
+    die->timeline.readyTime += duration;
+    die->timeline.busyTime += duration;
+
+    die->timeline.resumeTime = resumeTime;
+
+    return DZ_RESULT_OK;
+}
+
+/* ========================================================================> */
+
 /* Writes `src.ptr` to the page corresponding to `ppa` in `die`. */
 dzResult dzDieProgramPage(dzDie *die, dzPPA ppa, dzByteArray src) {
-    dzByte *pagePtr = dzDiePPAToPtr(die, ppa);
+    dzResult result = DZ_RESULT_INVALID_ARGUMENT;
 
-    if (pagePtr == NULL || src.ptr == NULL || src.size == 0U)
-        return DZ_RESULT_INVALID_ARGUMENT;
+    (void) dzDieProgramPages(die, &ppa, &src, &result, 1U);
 
-    {
-        dzF64 programLatency = -DBL_MAX;
+    return result;
+}
 
-        // NOTE: Erase-before-Write Property!
-        if (dzPageMarkAsValid(pagePtr,
-                              die->config.pageSizeInBytes,
-                              &programLatency)
-            != DZ_RESULT_OK)
-            return DZ_RESULT_ALREADY_VALID;
+/* 
+    Writes `srcs[i].ptr` to the page corresponding to `ppas[i]` in `die`, 
+    for each of the `count` pages in order, and stores the result of 
+    each write in `results[i]`.
+*/
+dzResult dzDieProgramPages(dzDie *die,
+                           const dzPPA *ppas,
+                           const dzByteArray *srcs,
+                           dzResult *results,
+                           dzU64 count) {
+    if (die == NULL || ppas == NULL || srcs == NULL || results == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
 
-        die->stats.totalProgramLatency += programLatency;
-        die->stats.totalProgramCount++;
+    // NOTE: Consecutive pages in the same block are programmed as a run
+    for (dzU64 i = 0U, runLength = 0U; i < count; i += runLength) {
+        runLength = dzDieGetRunLength(ppas + i, count - i);
+
+        dzDieProgramRun(die, ppas + i, srcs + i, results + i, runLength);
     }
 
-    dzU64 blockIndex = (ppa.planeId * die->config.blockCountPerPlane)
-                       + ppa.blockId;
+    return dzDieGetFirstError(results, count);
+}
 
-    dzBlockMetadata *blockMetadata = dzDieGetBlockMetadata(die, blockIndex);
+/* 
+    Writes `srcs[i].ptr` to the page corresponding to `ppas[i]` in `die`, 
+    for each of the `count` planes at once (multi-plane program).
+*/
+dzResult dzDieProgramMultiPlane(dzDie *die,
+                                const dzPPA *ppas,
+                                const dzByteArray *srcs,
+                                dzU64 count) {
+    if (!dzDieIsValidMultiPlaneOp(die, ppas, count, true) || srcs == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
 
-    {
-        // NOTE: Enforce "Sequential Page Programming"
-        if (ppa.pageId != dzBlockGetNextPageId(blockMetadata))
+    // NOTE: Check all planes first, so that a rejected command changes nothing
+    for (dzU64 i = 0U; i < count; i++) {
+        dzBlockMetadata *blockMetadata =
+            dzDieGetBlockMetadata(die, dzDiePBAToBlockIndex(die, ppas[i]));
+
+        if (dzBlockGetState(blockMetadata) == DZ_BLOCK_STATE_VICTIM)
+            return DZ_RESULT_INVALID_STATE;
+
+        if (dzDieGetPageState(die, ppas[i]) != DZ_PAGE_STATE_FREE)
+            return DZ_RESULT_ALREADY_VALID;
+
+        if (ppas[i].pageId != dzBlockGetNextPageId(blockMetadata))
             return DZ_RESULT_INVALID_SEQUENCE;
+
+        if (die->config.dataMode != DZ_DIE_DATA_MODE_NONE
+            && (srcs[i].ptr == NULL || srcs[i].size == 0U))
+            return DZ_RESULT_INVALID_ARGUMENT;
     }
 
-    {
-        dzPageState pageState = dzDieGetPageState(die, ppa);
+    // NOTE: The data of every page are allocated before any plane is written
+    if (die->config.dataMode == DZ_DIE_DATA_MODE_FULL)
+        for (dzU64 i = 0U; i < count; i++)
+            if (dzDieAllocPageData(die,
+                                   dzDiePBAToBlockIndex(die, ppas[i]),
+                                   ppas[i].pageId)
+                == NULL)
+                return DZ_RESULT_NO_MEMORY;
 
-        if (dzBlockUpdatePageStateMap(blockMetadata, pageState)
-            != DZ_RESULT_OK)
-            return DZ_RESULT_MAP_UPDATE_FAILED;
+    dzF64 totalProgramLatency = die->stats.totalProgramLatency;
 
-        /*
-            NOTE: Since at least one valid page is present in this block, 
-                  it can be marked as active
-        */
-        if (dzBlockAdvanceNextPageId(blockMetadata) != DZ_RESULT_OK
-            || dzBlockMarkAsActive(blockMetadata) != DZ_RESULT_OK)
-            return DZ_RESULT_INTERNAL_ERROR;
-    }
+    dzF64 maxLatency = 0.0;
 
-    dzPlaneMetadata *planeMetadata =
-        (dzPlaneMetadata *) (((dzByte *) die->metadata.planes)
-                             + (ppa.planeId * dzPlaneGetMetadataSize()));
+    for (dzU64 i = 0U; i < count; i++) {
+        dzResult result = dzDieProgramPage(die, ppas[i], srcs[i]);
 
-    {
-        dzBlockState blockState = dzDieGetBlockState(die, ppa);
+        if (result != DZ_RESULT_OK) return result;
 
-        if (dzPlaneUpdateBlockStateMap(planeMetadata, ppa, blockState)
-            != DZ_RESULT_OK)
-            return DZ_RESULT_MAP_UPDATE_FAILED;
+        if (maxLatency < die->lastLatency) maxLatency = die->lastLatency;
     }
 
-    (void) memcpy(pagePtr,
-                  src.ptr,
-                  ((src.size < die->config.pageSizeInBytes)
-                       ? src.size
-                       : die->config.pageSizeInBytes));
+    // NOTE: All planes are programmed concurrently
+    die->lastLatency = maxLatency;
+
+    die->stats.totalProgramLatency = totalProgramLatency + maxLatency;
 
     return DZ_RESULT_OK;
 }
@@ -487,26 +1365,117 @@ dzResult dzDieProgramPage(dzDie *die, dzPPA ppa, dzByteArray src) {
     copying it to `dst.ptr`. 
 */
 dzResult dzDieReadPage(dzDie *die, dzPPA ppa, dzByteArray dst) {
-    dzByte *pagePtr = dzDiePPAToPtr(die, ppa);
+    dzResult result = DZ_RESULT_INVALID_ARGUMENT;
 
-    if (pagePtr == NULL || dst.ptr == NULL
-        || dst.size < die->config.pageSizeInBytes)
+    (void) dzDieReadPages(die, &ppa, &dst, &result, 1U);
+
+    return result;
+}
+
+/* 
+    Reads data from the page corresponding to `ppas[i]` in `die`, 
+    and copies it to `dsts[i].ptr`, for each of the `count` pages 
+    in order, and stores the result of each read in `results[i]`.
+*/
+dzResult dzDieReadPages(dzDie *die,
+                        const dzPPA *ppas,
+                        const dzByteArray *dsts,
+                        dzResult *results,
+                        dzU64 count) {
+    if (die == NULL || ppas == NULL || dsts == NULL || results == NULL)
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    {
-        dzF64 readLatency = -DBL_MAX;
+    // NOTE: Consecutive pages in the same block are read as a run
+    for (dzU64 i = 0U, runLength = 0U; i < count; i += runLength) {
+        runLength = dzDieGetRunLength(ppas + i, count - i);
 
-        if (dzPageGetReadLatency(pagePtr,
-                                 die->config.pageSizeInBytes,
-                                 &readLatency)
-            != DZ_RESULT_OK)
-            return DZ_RESULT_INTERNAL_ERROR;
+        dzDieReadRun(die, ppas + i, dsts + i, results + i, runLength);
+    }
+
+    return dzDieGetFirstError(results, count);
+}
+
+/* 
+    Reads the page corresponding to `ppa` in `die` without copying 
+    its data, and stores a read-only view of the data in `view`.
+*/
+dzResult dzDieReadPageView(dzDie *die, dzPPA ppa, dzDiePageView *view) {
+    dzU64 pageIndex = dzDiePPAToPageIndex(die, ppa);
+
+    if (pageIndex == DZ_PAGE_INVALID_ID || view == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
 
-        die->stats.totalReadLatency += readLatency;
-        die->stats.totalReadCount++;
+    const dzByte *pagePtr = NULL;
+
+    if (die->config.dataMode == DZ_DIE_DATA_MODE_FULL) {
+        pagePtr = dzDieGetPageData(die,
+                                   dzDiePBAToBlockIndex(die, ppa),
+                                   ppa.pageId);
+
+        // NOTE: Pages that have never been programmed are in the erased state
+        if (pagePtr == NULL) pagePtr = dzDieGetErasedPage(die);
+
+        if (pagePtr == NULL) return DZ_RESULT_NO_MEMORY;
     }
 
-    (void) memcpy(dst.ptr, pagePtr, die->config.pageSizeInBytes);
+    // NOTE: The latency is accounted for exactly as in `dzDieReadPage()`
+    dzResult result = dzDieSensePage(die, pageIndex);
+
+    if (result != DZ_RESULT_OK) return result;
+
+    *view = (dzDiePageView) {
+        .ptr = pagePtr,
+        .size = (pagePtr != NULL) ? die->config.pageSizeInBytes : 0U,
+        .generation = die->buffer.eraseGeneration
+    };
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Returns `true` if `view` still points to the data of its page in `die`, 
+    i.e. no block in `die` has been erased since `view` was created.
+*/
+dzBool dzDieIsPageViewValid(const dzDie *die, dzDiePageView view) {
+    return die != NULL && view.ptr != NULL
+           && view.generation == die->buffer.eraseGeneration;
+}
+
+/* 
+    Reads data from the page corresponding to `ppas[i]` in `die`, 
+    and copies it to `dsts[i].ptr`, for each of the `count` planes 
+    at once (multi-plane read).
+*/
+dzResult dzDieReadMultiPlane(dzDie *die,
+                             const dzPPA *ppas,
+                             const dzByteArray *dsts,
+                             dzU64 count) {
+    if (!dzDieIsValidMultiPlaneOp(die, ppas, count, true) || dsts == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: Check all planes first, so that a rejected command senses nothing
+    if (die->config.dataMode == DZ_DIE_DATA_MODE_FULL)
+        for (dzU64 i = 0U; i < count; i++)
+            if (dsts[i].ptr == NULL
+                || dsts[i].size < die->config.pageSizeInBytes)
+                return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzF64 totalReadLatency = die->stats.totalReadLatency;
+
+    dzF64 maxLatency = 0.0;
+
+    for (dzU64 i = 0U; i < count; i++) {
+        dzResult result = dzDieReadPage(die, ppas[i], dsts[i]);
+
+        if (result != DZ_RESULT_OK) return result;
+
+        if (maxLatency < die->lastLatency) maxLatency = die->lastLatency;
+    }
+
+    // NOTE: All planes sense their pages concurrently
+    die->lastLatency = maxLatency;
+
+    die->stats.totalReadLatency = totalReadLatency + maxLatency;
 
     return DZ_RESULT_OK;
 }
@@ -520,7 +1489,15 @@ dzResult dzDieReadParameterPage(dzDie *die, dzByteArray dst) {
         || dst.size < die->config.pageSizeInBytes)
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    (void) memcpy(dst.ptr, die->buffer, die->config.pageSizeInBytes);
+    // NOTE: The parameter page is generated on demand in 'dataless' modes
+    if (die->config.dataMode != DZ_DIE_DATA_MODE_FULL)
+        return dzOnfiCreateParameterPage(die, dst);
+
+    const dzByte *pagePtr = dzDieGetPageData(die, 0U, 0U);
+
+    if (pagePtr == NULL) return DZ_RESULT_INVALID_STATE;
+
+    (void) memcpy(dst.ptr, pagePtr, die->config.pageSizeInBytes);
 
     return DZ_RESULT_OK;
 }
@@ -532,13 +1509,53 @@ dzResult dzDieEraseBlock(dzDie *die, dzPBA pba) {
 
     dzResult result = DZ_RESULT_OK;
 
-    dzU64 blockIndex = (pba.planeId * die->config.blockCountPerPlane)
-                       + pba.blockId;
+    die->status &= (dzByte) ~DZ_DIE_STATUS_FAIL;
+
+    // NOTE: Page data may be dropped or reused, even if the erase fails
+    die->buffer.eraseGeneration++;
+
+    dzU64 blockIndex = dzDiePBAToBlockIndex(die, pba);
+
+    if (die->buffer.pageTables != NULL) {
+        dzDiePageTable *pageTable = die->buffer.pageTables[blockIndex];
+
+        // NOTE: Shared pages are dropped instead of being copied and erased
+        if (pageTable != NULL && dzDieIsShared(&pageTable->refCount)) {
+            for (dzU64 i = 0U; i < die->config.pageCountPerBlock; i++)
+                if (pageTable->pages[i] != NULL)
+                    die->buffer.residentPageCount--;
+
+            dzDieReleasePageTable(pageTable, die->config.pageCountPerBlock);
+
+            die->buffer.pageTables[blockIndex] = pageTable = NULL;
+        }
+
+        /*
+            NOTE: Private pages are not cleared here, since free pages 
+                  are read as erased and cleared when programmed again
+        */
+        for (dzU64 i = 0U; i < die->config.pageCountPerBlock; i++) {
+            if (pageTable == NULL) break;
+
+            dzDiePageData *pageData = pageTable->pages[i];
+
+            if (pageData == NULL || !dzDieIsShared(&pageData->refCount))
+                continue;
 
-    dzDieForEachPageInBlock(die->buffer, die->metadata, blockIndex, pagePtr) {
-        (void) memset(pagePtr, (dzByte) 0xFF, die->config.pageSizeInBytes);
+            dzDieReleasePageData(pageData);
+
+            pageTable->pages[i] = NULL, die->buffer.residentPageCount--;
+        }
+    } else if (die->buffer.fingerprints != NULL) {
+        (void) memset(die->buffer.fingerprints
+                          + (blockIndex * die->config.pageCountPerBlock),
+                      0,
+                      die->config.pageCountPerBlock
+                          * sizeof *(die->buffer.fingerprints));
+    }
 
-        if (dzPageMarkAsFree(pagePtr, die->config.pageSizeInBytes)
+    dzDieForEachPageInBlock(die, blockIndex, pageIndex) {
+        if (dzPageMarkAsFree(die->metadata.pages, pageIndex)
             != DZ_RESULT_OK) {
             result = DZ_RESULT_ALREADY_FREE;
 
@@ -548,19 +1565,35 @@ dzResult dzDieEraseBlock(dzDie *die, dzPBA pba) {
 
     dzBlockMetadata *blockMetadata = dzDieGetBlockMetadata(die, blockIndex);
 
+    {
+        dzPlaneMetadata *planeMetadata = dzDieGetPlaneMetadata(die,
+                                                               pba.planeId);
+
+        dzU64 validPageCount = dzBlockGetValidPageCount(blockMetadata);
+        dzU64 invalidPageCount = dzBlockGetInvalidPageCount(blockMetadata);
+
+        // NOTE: No valid or invalid pages remain, even if the erase failed
+        (void) dzPlaneUpdatePageCounts(planeMetadata,
+                                       DZ_PAGE_STATE_VALID,
+                                       DZ_PAGE_STATE_FREE,
+                                       validPageCount);
+
+        (void) dzPlaneUpdatePageCounts(planeMetadata,
+                                       DZ_PAGE_STATE_INVALID,
+                                       DZ_PAGE_STATE_FREE,
+                                       invalidPageCount);
+    }
+
     if (result != DZ_RESULT_OK) {
+        die->status |= DZ_DIE_STATUS_FAIL;
+
         /* NOTE: Mark all pages in this block as bad */
 
         // clang-format off
 
-        dzDieForEachPageInBlock(die->buffer,
-                                die->metadata,
-                                blockIndex,
-                                pagePtr) {
-            ((void) dzPageMarkAsUnknown(pagePtr, 
-                                        die->config.pageSizeInBytes));
-            ((void) dzPageMarkAsBad(pagePtr,
-                                    die->config.pageSizeInBytes));
+        dzDieForEachPageInBlock(die, blockIndex, pageIndex) {
+            ((void) dzPageMarkAsUnknown(die->metadata.pages, pageIndex));
+            ((void) dzPageMarkAsBad(die->metadata.pages, pageIndex));
         }
 
         // clang-format on
@@ -583,156 +1616,824 @@ dzResult dzDieEraseBlock(dzDie *die, dzPBA pba) {
     {
         dzF64 eraseLatency = -DBL_MAX;
 
-        if (dzBlockMarkAsFree(blockMetadata, &eraseLatency) != DZ_RESULT_OK)
-            return DZ_RESULT_INTERNAL_ERROR;
+        if (dzBlockMarkAsFree(blockMetadata, &(die->rng), &eraseLatency)
+            != DZ_RESULT_OK)
+            return DZ_RESULT_INTERNAL_ERROR;
+
+        die->lastLatency = eraseLatency;
+
+        die->stats.totalEraseLatency += eraseLatency;
+        die->stats.totalEraseCount++;
+    }
+
+    {
+        dzPlaneMetadata *planeMetadata = dzDieGetPlaneMetadata(die,
+                                                               pba.planeId);
+
+        dzBlockState blockState = dzBlockGetState(blockMetadata);
+
+        if (dzPlaneUpdateBlockStateMap(planeMetadata, pba, blockState)
+            != DZ_RESULT_OK)
+            return DZ_RESULT_MAP_UPDATE_FAILED;
+
+        dzU64 totalEraseCount = dzBlockGetTotalEraseCount(blockMetadata);
+
+        if (dzPlaneUpdateLeastWornBlock(planeMetadata, pba, totalEraseCount)
+            != DZ_RESULT_OK)
+            return DZ_RESULT_INTERNAL_ERROR;
+    }
+
+    return result;
+}
+
+/* 
+    Erases the block corresponding to `pbas[i]` in `die`, for each of 
+    the `count` blocks in order, and stores the result of each erase 
+    in `results[i]`.
+*/
+dzResult dzDieEraseBlocks(dzDie *die,
+                          const dzPBA *pbas,
+                          dzResult *results,
+                          dzU64 count) {
+    if (die == NULL || pbas == NULL || results == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: An erase already works on a whole block, so there is no run
+    for (dzU64 i = 0U; i < count; i++)
+        results[i] = dzDieEraseBlock(die, pbas[i]);
+
+    return dzDieGetFirstError(results, count);
+}
+
+/* 
+    Erases the block corresponding to `pbas[i]` in `die`, 
+    for each of the `count` planes at once (multi-plane erase).
+*/
+dzResult dzDieEraseMultiPlane(dzDie *die, const dzPBA *pbas, dzU64 count) {
+    if (!dzDieIsValidMultiPlaneOp(die, pbas, count, false))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: Check all planes first, so that a rejected command changes nothing
+    for (dzU64 i = 0U; i < count; i++) {
+        dzU64 blockIndex = dzDiePBAToBlockIndex(die, pbas[i]);
+
+        dzDieForEachPageInBlock(die, blockIndex, pageIndex) {
+            dzPageState pageState = dzPageGetState(die->metadata.pages,
+                                                   pageIndex);
+
+            if (pageState == DZ_PAGE_STATE_BAD
+                || pageState == DZ_PAGE_STATE_FREE
+                || pageState == DZ_PAGE_STATE_RESERVED)
+                return DZ_RESULT_ALREADY_FREE;
+        }
+    }
+
+    dzF64 totalEraseLatency = die->stats.totalEraseLatency;
+
+    dzF64 maxLatency = 0.0;
+
+    for (dzU64 i = 0U; i < count; i++) {
+        dzResult result = dzDieEraseBlock(die, pbas[i]);
+
+        if (result != DZ_RESULT_OK) return result;
+
+        if (maxLatency < die->lastLatency) maxLatency = die->lastLatency;
+    }
+
+    // NOTE: All planes are erased concurrently
+    die->lastLatency = maxLatency;
+
+    die->stats.totalEraseLatency = totalEraseLatency + maxLatency;
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Marks the page corresponding to `ppa` in `die` as invalid, 
+    e.g. when its data have been overwritten or trimmed.
+*/
+dzResult dzDieInvalidatePage(dzDie *die, dzPPA ppa) {
+    dzU64 pageIndex = dzDiePPAToPageIndex(die, ppa);
+
+    if (pageIndex == DZ_PAGE_INVALID_ID) return DZ_RESULT_INVALID_ARGUMENT;
+
+    if (dzPageGetState(die->metadata.pages, pageIndex) != DZ_PAGE_STATE_VALID)
+        return DZ_RESULT_INVALID_STATE;
+
+    dzBlockMetadata *blockMetadata =
+        dzDieGetBlockMetadata(die, dzDiePBAToBlockIndex(die, ppa));
+
+    dzPlaneMetadata *planeMetadata = dzDieGetPlaneMetadata(die, ppa.planeId);
+
+    // NOTE: The maps are updated first, so that a failure changes nothing
+    if (dzPlaneUpdatePageCounts(planeMetadata,
+                                DZ_PAGE_STATE_VALID,
+                                DZ_PAGE_STATE_INVALID,
+                                1U)
+        != DZ_RESULT_OK)
+        return DZ_RESULT_MAP_UPDATE_FAILED;
+
+    if (dzBlockInvalidatePage(blockMetadata, ppa.pageId) != DZ_RESULT_OK) {
+        (void) dzPlaneUpdatePageCounts(planeMetadata,
+                                       DZ_PAGE_STATE_INVALID,
+                                       DZ_PAGE_STATE_VALID,
+                                       1U);
+
+        return DZ_RESULT_MAP_UPDATE_FAILED;
+    }
+
+    // NOTE: The data of an invalid page stay intact until it is erased
+    (void) dzPageMarkAsInvalid(die->metadata.pages, pageIndex);
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Marks the block corresponding to `pba` in `die` 
+    as a victim for garbage collection.
+*/
+dzResult dzDieMarkBlockAsVictim(dzDie *die, dzPBA pba) {
+    if (die == NULL || !dzDieIsValidPBA(die, pba))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzBlockMetadata *blockMetadata =
+        dzDieGetBlockMetadata(die, dzDiePBAToBlockIndex(die, pba));
+
+    if (dzBlockMarkAsVictim(blockMetadata) != DZ_RESULT_OK)
+        return DZ_RESULT_INVALID_STATE;
+
+    if (dzPlaneUpdateBlockStateMap(dzDieGetPlaneMetadata(die, pba.planeId),
+                                   pba,
+                                   DZ_BLOCK_STATE_VICTIM)
+        != DZ_RESULT_OK)
+        return DZ_RESULT_MAP_UPDATE_FAILED;
+
+    return DZ_RESULT_OK;
+}
+
+/* Private Functions ======================================================> */
+
+/* 
+    Initializes `*die` with the given `config`, backed by 
+    a new image file at `path` unless `path` is `NULL`.
+*/
+static dzResult dzDieInitWithImage(dzDie **die,
+                                   dzDieConfig config,
+                                   const char *path) {
+    if (die == NULL || !dzDieIsValidConfig(config))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzDie *newDie = dzDieCreate(config);
+
+    if (newDie == NULL) return DZ_RESULT_NO_MEMORY;
+
+    if (!dzDieInitMetadata(newDie)) {
+        dzDieDeinit(newDie);
+
+        return DZ_RESULT_INVALID_METADATA;
+    }
+
+    if (path != NULL) {
+        if (!dzDieCreateImageBuffer(newDie, path)) {
+            dzDieDeinit(newDie);
+
+            return DZ_RESULT_IO_ERROR;
+        }
+    } else if (!dzDieCreateBuffer(newDie)) {
+        dzDieDeinit(newDie);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    if (!dzDieInitPageMetadata(newDie)) {
+        dzDieDeinit(newDie);
+
+        return DZ_RESULT_INVALID_METADATA;
+    }
+
+    if (!dzDieCorruptRandomBlocks(newDie)) {
+        dzDieDeinit(newDie);
+
+        return DZ_RESULT_INJECTION_FAILED;
+    }
+
+    if (!dzDieProgramParameterPage(newDie)) {
+        dzDieDeinit(newDie);
+
+        return DZ_RESULT_INTERNAL_ERROR;
+    }
+
+    *die = newDie;
+
+    return DZ_RESULT_OK;
+}
+
+/* Creates a new `die` with the given `config`, without any metadata. */
+static dzDie *dzDieCreate(dzDieConfig config) {
+    dzDie *newDie = malloc(sizeof *newDie);
+
+    if (newDie == NULL) return newDie;
+
+    {
+        newDie->config = config;
+
+        newDie->stats = (dzDieStatistics) { .totalProgramLatency = 0.0,
+                                            .totalProgramCount = 0U,
+                                            .totalReadLatency = 0.0,
+                                            .totalReadCount = 0U,
+                                            .totalEraseLatency = 0.0,
+                                            .totalEraseCount = 0U };
+
+        newDie->metadata = (dzDieMetadata) { .planes = NULL,
+                                             .blocks = NULL,
+                                             .pages = NULL,
+                                             .pageArrays = NULL,
+                                             .stateMaps = NULL };
+
+        newDie->buffer = (dzDieBuffer) { .pageTables = NULL,
+                                         .pageData = NULL,
+                                         .fingerprints = NULL,
+                                         .image = NULL,
+                                         .erasedPage = NULL,
+                                         .imageSize = 0U,
+                                         .residentPageCount = 0U,
+                                         .eraseGeneration = 0U };
+
+        // NOTE: Both arrays of the timeline share a single allocation
+        newDie->timeline = (dzDieTimeline) {
+            .planeReadyTimes = calloc(2U * (dzU64) config.planeCountPerDie,
+                                      sizeof(dzU64)),
+            .readyTime = 0U,
+            .busyTime = 0U,
+            .cacheReadyTime = 0U,
+            .resumeTime = 0U,
+            .activeOp = NULL
+        };
+
+        if (newDie->timeline.planeReadyTimes == NULL) {
+            free(newDie);
+
+            return NULL;
+        }
+
+        newDie->timeline.planeBusyTimes = newDie->timeline.planeReadyTimes
+                                          + config.planeCountPerDie;
+
+        newDie->lastLatency = 0.0;
+
+        newDie->status = DZ_DIE_STATUS_WP_N;
+
+        // NOTE: Dies with the same seed draw from non-overlapping streams
+        dzUtilsRngInit(&(newDie->rng), config.seed);
+
+        for (dzU64 i = 0U; i < config.dieId; i++)
+            dzUtilsRngJump(&(newDie->rng));
+    }
+
+    return newDie;
+}
+
+/* Mark a random number of blocks as bad. */
+static bool dzDieCorruptRandomBlocks(dzDie *die) {
+    if (die == NULL || die->metadata.blockCountPerDie <= 1) return false;
+
+    dzU64 blockCountPerDie = die->metadata.blockCountPerDie;
+
+    if (die->config.badBlockRatio <= 0.0) return true;
+
+    dzF64 badBlockRatio = dzUtilsRngRangeF64(&(die->rng),
+                                             0.001,
+                                             die->config.badBlockRatio);
+
+    dzU64 badBlockCount = (dzU64) ceil(badBlockRatio
+                                       * (dzF64) blockCountPerDie);
+
+    if (badBlockCount == 0U) badBlockCount++;
+
+    // NOTE: Block #0 is always guaranteed to be a 'good' block
+    dzU64 blockIndex = dzUtilsRngRange(&(die->rng), 1U, blockCountPerDie - 1);
+
+    while (badBlockCount > 0U) {
+        dzBlockMetadata *blockMetadata = dzDieGetBlockMetadata(die,
+                                                               blockIndex);
+
+        // NOTE: Draws another block, instead of retrying the same one forever
+        if (dzBlockGetState(blockMetadata) == DZ_BLOCK_STATE_BAD) {
+            blockIndex = dzUtilsRngRange(&(die->rng),
+                                         1U,
+                                         blockCountPerDie - 1U);
+
+            continue;
+        }
+
+        // clang-format off
+
+        dzDieForEachPageInBlock(die, blockIndex, pageIndex) {
+            ((void) dzPageMarkAsUnknown(die->metadata.pages, pageIndex));
+            ((void) dzPageMarkAsFactoryBad(die->metadata.pages, pageIndex));
+        }
+
+        // clang-format on
+
+        (void) dzBlockMarkAsUnknown(blockMetadata);
+        (void) dzBlockMarkAsBad(blockMetadata);
+
+        {
+            dzPBA pba = dzBlockGetPBA(blockMetadata);
+
+            dzPlaneMetadata *planeMetadata =
+                dzDieGetPlaneMetadata(die, pba.planeId);
+
+            dzBlockState blockState = dzDieGetBlockState(die, pba);
+
+            if (dzPlaneUpdateBlockStateMap(planeMetadata, pba, blockState)
+                != DZ_RESULT_OK)
+                return false;
+        }
+
+        dzU64 newBlockIndex = dzDieGetAdjacentBlockIndex(die, blockIndex);
+
+        // NOTE: Corruption may or may not spread within an one-block radius
+        if ((dzUtilsRngNext(&(die->rng)) & 1U)
+            || newBlockIndex == DZ_BLOCK_INVALID_ID)
+            blockIndex = dzUtilsRngRange(&(die->rng),
+                                         1U,
+                                         blockCountPerDie - 1U);
+        else
+            blockIndex = newBlockIndex;
+
+        badBlockCount--;
+    }
+
+    return true;
+}
+
+/* 
+    Returns the pointer to the data of the `pageId`-th page 
+    in the `blockIndex`-th block, allocating it on demand.
+    The contents of the page are undefined until written.
+*/
+static dzByte *dzDieAllocPageData(dzDie *die, dzU64 blockIndex, dzU64 pageId) {
+    if (die != NULL && die->buffer.pageData != NULL
+        && blockIndex < die->metadata.blockCountPerDie
+        && pageId < die->config.pageCountPerBlock) {
+        dzU64 pageIndex = (blockIndex * die->config.pageCountPerBlock)
+                          + pageId;
+
+        return die->buffer.pageData
+               + (pageIndex * die->config.pageSizeInBytes);
+    }
+
+    if (die == NULL || die->buffer.pageTables == NULL
+        || pageId >= die->config.pageCountPerBlock)
+        return NULL;
+
+    dzDiePageTable *pageTable = dzDieGetPrivatePageTable(die, blockIndex);
+
+    if (pageTable == NULL) return NULL;
+
+    dzU64 eraseCount =
+        dzBlockGetTotalEraseCount(dzDieGetBlockMetadata(die, blockIndex));
+
+    dzDiePageData *pageData = pageTable->pages[pageId];
+
+    if (pageData != NULL) {
+        if (!dzDieIsShared(&pageData->refCount)) {
+            pageData->eraseCount = eraseCount;
+
+            return pageData->data;
+        }
+
+        /*
+            NOTE: A shared page is only written to after it has been erased, 
+                  so its contents never need to be copied
+        */
+        dzDieReleasePageData(pageData);
+
+        pageTable->pages[pageId] = NULL, die->buffer.residentPageCount--;
+    }
+
+    pageData = malloc(sizeof *pageData + die->config.pageSizeInBytes);
+
+    if (pageData == NULL) return NULL;
+
+    pageData->refCount = 1U;
+    pageData->eraseCount = eraseCount;
+
+    pageTable->pages[pageId] = pageData, die->buffer.residentPageCount++;
+
+    return pageData->data;
+}
+
+/* 
+    Returns the page table of the `blockIndex`-th block in `die`, 
+    allocating it on demand, or copying it if it is shared.
+*/
+static dzDiePageTable *dzDieGetPrivatePageTable(dzDie *die, dzU64 blockIndex) {
+    if (die == NULL || die->buffer.pageTables == NULL
+        || blockIndex >= die->metadata.blockCountPerDie)
+        return NULL;
+
+    dzDiePageTable *pageTable = die->buffer.pageTables[blockIndex];
+
+    if (pageTable != NULL && !dzDieIsShared(&pageTable->refCount))
+        return pageTable;
+
+    dzUSize pageTableSize = sizeof *pageTable
+                            + (die->config.pageCountPerBlock
+                               * sizeof *(pageTable->pages));
+
+    dzDiePageTable *newPageTable = calloc(1U, pageTableSize);
+
+    if (newPageTable == NULL) return NULL;
+
+    newPageTable->refCount = 1U;
+
+    if (pageTable != NULL) {
+        // NOTE: The pages themselves remain shared until they are written to
+        for (dzU64 i = 0U; i < die->config.pageCountPerBlock; i++) {
+            dzDiePageData *pageData = pageTable->pages[i];
+
+            if (pageData != NULL) dzDieRetain(&pageData->refCount);
+
+            newPageTable->pages[i] = pageData;
+        }
+
+        dzDieReleasePageTable(pageTable, die->config.pageCountPerBlock);
+    }
+
+    die->buffer.pageTables[blockIndex] = newPageTable;
+
+    return newPageTable;
+}
+
+/* Releases a reference to `pageTable` with `pageCount` entries. */
+static void dzDieReleasePageTable(dzDiePageTable *pageTable, dzU64 pageCount) {
+    if (pageTable == NULL
+        || __atomic_sub_fetch(&pageTable->refCount, 1U, __ATOMIC_ACQ_REL) > 0U)
+        return;
+
+    for (dzU64 i = 0U; i < pageCount; i++)
+        dzDieReleasePageData(pageTable->pages[i]);
+
+    free(pageTable);
+}
+
+/* Releases a reference to `pageData`. */
+static void dzDieReleasePageData(dzDiePageData *pageData) {
+    if (pageData == NULL
+        || __atomic_sub_fetch(&pageData->refCount, 1U, __ATOMIC_ACQ_REL) > 0U)
+        return;
+
+    free(pageData);
+}
+
+/* 
+    Returns the pointer to a page of `die` in the erased state, 
+    allocating it on demand.
+*/
+static const dzByte *dzDieGetErasedPage(dzDie *die) {
+    if (die->buffer.erasedPage != NULL) return die->buffer.erasedPage;
+
+    die->buffer.erasedPage = malloc(die->config.pageSizeInBytes);
+
+    if (die->buffer.erasedPage == NULL) return NULL;
+
+    // NOTE: Simulating the 'erased' state by setting all bits to `1`
+    (void) memset(die->buffer.erasedPage,
+                  (dzByte) 0xFF,
+                  die->config.pageSizeInBytes);
+
+    return die->buffer.erasedPage;
+}
+
+/* Creates the page metadata arrays and the page table of `die`. */
+static bool dzDieCreateBuffer(dzDie *die) {
+    if (die == NULL) return false;
+
+    /* 
+        NOTE: Page metadata are kept in per-die arrays (separate from 
+              the page data), so that metadata scans never touch page data
+    */
+    die->metadata.pageArrays = malloc(
+        dzPageGetArrayRegionSize(die->metadata.pageCountPerDie));
+
+    if (die->metadata.pageArrays == NULL) return false;
+
+    if (die->config.dataMode == DZ_DIE_DATA_MODE_FULL) {
+        /* 
+            NOTE: Data pages are allocated on their first 'program' operation, 
+                  so the memory usage grows with the written footprint only
+        */
+        die->buffer.pageTables = calloc(die->metadata.blockCountPerDie,
+                                        sizeof *(die->buffer.pageTables));
+
+        if (die->buffer.pageTables == NULL) return false;
+    } else if (die->config.dataMode == DZ_DIE_DATA_MODE_FINGERPRINT) {
+        die->buffer.fingerprints = calloc(die->metadata.pageCountPerDie,
+                                          sizeof *(die->buffer.fingerprints));
+
+        if (die->buffer.fingerprints == NULL) return false;
+    }
+
+    return true;
+}
+
+/* Releases the page metadata arrays and the page table of `die`. */
+static void dzDieDeleteBuffer(dzDie *die) {
+    if (die == NULL) return;
+
+    free(die->buffer.erasedPage), die->buffer.erasedPage = NULL;
+
+    if (die->buffer.image != NULL) {
+        (void) munmap(die->buffer.image, die->buffer.imageSize);
+
+        die->buffer.pageData = NULL, die->buffer.fingerprints = NULL;
+
+        die->buffer.image = NULL, die->buffer.imageSize = 0U;
+
+        die->metadata.pageArrays = NULL;
+
+        return;
+    }
+
+    for (dzU64 i = 0U; i < die->metadata.blockCountPerDie; i++) {
+        if (die->buffer.pageTables == NULL) break;
+
+        // NOTE: Shared pages are freed by the last die referencing them
+        dzDieReleasePageTable(die->buffer.pageTables[i],
+                              die->config.pageCountPerBlock);
+    }
+
+    free(die->buffer.pageTables), free(die->buffer.fingerprints);
+
+    free(die->metadata.pageArrays);
+
+    die->buffer.pageTables = NULL, die->buffer.fingerprints = NULL;
+
+    die->metadata.pageArrays = NULL;
+
+    die->buffer.residentPageCount = 0U;
+}
+
+/* 
+    Creates the page metadata arrays and the page data of `die` 
+    within a new image file at `path`.
+*/
+static bool dzDieCreateImageBuffer(dzDie *die, const char *path) {
+    if (die == NULL || path == NULL) return false;
+
+    dzDieImageHeader header;
+
+    dzDieInitImageHeader(die, &header);
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0) return false;
+
+    // NOTE: The image file remains sparse until pages are actually written
+    if (ftruncate(fd, (off_t) header.imageSize) != 0) {
+        (void) close(fd);
+
+        return false;
+    }
+
+    dzByte *image = mmap(NULL,
+                         header.imageSize,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED,
+                         fd,
+                         0);
+
+    (void) close(fd);
+
+    if (image == MAP_FAILED) return false;
+
+    // NOTE: The image stays 'dirty' until `die` is de-initialized
+    header.isDirty = 1U;
+
+    (void) memcpy(image, &header, sizeof header);
+
+    dzDieAttachImage(die, image, &header);
+
+    return true;
+}
+
+/* Points the buffer of `die` to the mapped `image`. */
+static void dzDieAttachImage(dzDie *die,
+                             dzByte *image,
+                             const dzDieImageHeader *header) {
+    die->buffer.image = image;
+    die->buffer.imageSize = header->imageSize;
+
+    die->metadata.pageArrays = image + header->pageArraysOffset;
+
+    if (die->config.dataMode == DZ_DIE_DATA_MODE_FULL) {
+        die->buffer.pageData = image + header->bufferOffset;
+
+        // NOTE: All pages are backed by the image file
+        die->buffer.residentPageCount = die->metadata.pageCountPerDie;
+    } else if (die->config.dataMode == DZ_DIE_DATA_MODE_FINGERPRINT) {
+        die->buffer.fingerprints = (dzU64 *) (image + header->bufferOffset);
+    }
+
+    ((dzDieImageHeader *) image)->isDirty = 1U;
+}
+
+/* Computes the image file layout of `die`, and stores it in `header`. */
+static void dzDieInitImageHeader(const dzDie *die, dzDieImageHeader *header) {
+    (void) memset(header, 0, sizeof *header);
+
+    (void) memcpy(header->magic, DZ_DIE_IMAGE_MAGIC, sizeof header->magic);
+
+    header->layoutVersion = DZ_DIE_IMAGE_LAYOUT_VERSION;
+    header->headerSize = sizeof *header;
 
-        die->stats.totalEraseLatency += eraseLatency;
-        die->stats.totalEraseCount++;
-    }
+    header->config = die->config;
+    header->stats = die->stats;
+    header->rng = die->rng;
 
-    {
-        dzPlaneMetadata *planeMetadata = dzDieGetPlaneMetadata(die,
-                                                               pba.planeId);
+    dzU64 stateSize = dzDieGetStateSize(die);
 
-        dzBlockState blockState = dzBlockGetState(blockMetadata);
+    dzU64 bufferSize = 0U;
 
-        if (dzPlaneUpdateBlockStateMap(planeMetadata, pba, blockState)
-            != DZ_RESULT_OK)
-            return DZ_RESULT_MAP_UPDATE_FAILED;
+    if (die->config.dataMode == DZ_DIE_DATA_MODE_FULL)
+        bufferSize = die->metadata.pageCountPerDie
+                     * die->config.pageSizeInBytes;
+    else if (die->config.dataMode == DZ_DIE_DATA_MODE_FINGERPRINT)
+        bufferSize = die->metadata.pageCountPerDie * sizeof(dzU64);
 
-        dzU64 totalEraseCount = dzBlockGetTotalEraseCount(blockMetadata);
+    header->pageArraysOffset = dzDieAlignImageOffset(sizeof *header);
 
-        if (dzPlaneUpdateLeastWornBlock(planeMetadata, pba, totalEraseCount)
-            != DZ_RESULT_OK)
-            return DZ_RESULT_INTERNAL_ERROR;
-    }
+    header->stateOffset = dzDieAlignImageOffset(
+        header->pageArraysOffset
+        + dzPageGetArrayRegionSize(die->metadata.pageCountPerDie));
 
-    return result;
+    header->bufferOffset = dzDieAlignImageOffset(header->stateOffset
+                                                 + stateSize);
+
+    header->imageSize = dzDieAlignImageOffset(header->bufferOffset
+                                              + bufferSize);
 }
 
-/* Private Functions ======================================================> */
+/* Writes the current state of `die` back to its image file. */
+static bool dzDieSyncImage(dzDie *die) {
+    if (die == NULL || die->buffer.image == NULL) return false;
 
-/* Mark a random number of blocks as bad. */
-static bool dzDieCorruptRandomBlocks(dzDie *die) {
-    if (die == NULL || die->metadata.blockCountPerDie <= 1) return false;
+    dzDieImageHeader *header = (dzDieImageHeader *) die->buffer.image;
 
-    dzU64 blockCountPerDie = die->metadata.blockCountPerDie;
+    dzByteStream dst = { .ptr = die->buffer.image + header->stateOffset,
+                         .size = header->bufferOffset - header->stateOffset,
+                         .offset = 0U };
 
-    if (die->config.badBlockRatio <= 0.0) return true;
+    if (!dzDieWriteState(die, &dst)) return false;
 
-    dzF64 badBlockRatio = dzUtilsRandRangeF64(0.001,
-                                              die->config.badBlockRatio);
+    header->stats = die->stats;
+    header->rng = die->rng;
 
-    dzU64 badBlockCount = (dzU64) ceil(badBlockRatio
-                                       * (dzF64) blockCountPerDie);
+    header->isDirty = 0U;
 
-    if (badBlockCount == 0U) badBlockCount++;
+    return (msync(die->buffer.image, die->buffer.imageSize, MS_SYNC) == 0);
+}
 
-    // NOTE: Block #0 is always guaranteed to be a 'good' block
-    dzU64 blockIndex = dzUtilsRandRange(1U, blockCountPerDie - 1);
+/* Reads the page data of `die` from the snapshot in `stream`. */
+static dzResult dzDieLoadPayload(dzDie *die,
+                                 FILE *stream,
+                                 const dzDieSnapshotHeader *header) {
+    if (die == NULL || stream == NULL || header == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
 
-    while (badBlockCount > 0U) {
-        dzBlockMetadata *blockMetadata = dzDieGetBlockMetadata(die,
-                                                               blockIndex);
+    if (header->hasPayload
+        && die->config.dataMode == DZ_DIE_DATA_MODE_FINGERPRINT) {
+        if (fread(die->buffer.fingerprints,
+                  sizeof *(die->buffer.fingerprints),
+                  die->metadata.pageCountPerDie,
+                  stream)
+            != die->metadata.pageCountPerDie)
+            return DZ_RESULT_IO_ERROR;
+    }
 
-        if (dzBlockGetState(blockMetadata) == DZ_BLOCK_STATE_BAD) continue;
+    if (die->config.dataMode != DZ_DIE_DATA_MODE_FULL) return DZ_RESULT_OK;
 
-        // clang-format off
+    for (dzU64 i = 0U; i < header->payloadPageCount; i++) {
+        dzU64 pageIndex = DZ_PAGE_INVALID_ID;
 
-        dzDieForEachPageInBlock(die->buffer,
-                                die->metadata,
-                                blockIndex,
-                                pagePtr) {
-            ((void) dzPageMarkAsUnknown(pagePtr, 
-                                        die->config.pageSizeInBytes));
-            ((void) dzPageMarkAsFactoryBad(pagePtr,
-                                           die->config.pageSizeInBytes));
-        }
+        if (fread(&pageIndex, sizeof pageIndex, 1U, stream) != 1U)
+            return DZ_RESULT_IO_ERROR;
 
-        // clang-format on
+        if (pageIndex >= die->metadata.pageCountPerDie)
+            return DZ_RESULT_INVALID_IMAGE;
 
-        (void) dzBlockMarkAsUnknown(blockMetadata);
-        (void) dzBlockMarkAsBad(blockMetadata);
+        dzByte *pagePtr =
+            dzDieAllocPageData(die,
+                               pageIndex / die->config.pageCountPerBlock,
+                               pageIndex % die->config.pageCountPerBlock);
 
-        {
-            dzPBA pba = dzBlockGetPBA(blockMetadata);
+        if (pagePtr == NULL) return DZ_RESULT_NO_MEMORY;
 
-            dzPlaneMetadata *planeMetadata =
-                dzDieGetPlaneMetadata(die, pba.planeId);
+        if (fread(pagePtr, die->config.pageSizeInBytes, 1U, stream) != 1U)
+            return DZ_RESULT_IO_ERROR;
+    }
 
-            dzBlockState blockState = dzDieGetBlockState(die, pba);
+    // NOTE: The ONFI parameter page is regenerated if it was not saved
+    if (dzDieGetPageData(die, 0U, 0U) == NULL) {
+        dzByteArray firstPage = { .ptr = dzDieAllocPageData(die, 0U, 0U),
+                                  .size = die->config.pageSizeInBytes };
 
-            if (dzPlaneUpdateBlockStateMap(planeMetadata, pba, blockState)
-                != DZ_RESULT_OK)
-                return false;
-        }
+        // NOTE: Simulating the 'erased' state by setting all bits to `1`
+        if (firstPage.ptr != NULL)
+            (void) memset(firstPage.ptr, (dzByte) 0xFF, firstPage.size);
 
-        dzU64 newBlockIndex = dzDieGetAdjacentBlockIndex(die, blockIndex);
+        if (dzOnfiCreateParameterPage(die, firstPage) != DZ_RESULT_OK)
+            return DZ_RESULT_INTERNAL_ERROR;
+    }
 
-        // NOTE: Corruption may or may not spread within an one-block radius
-        if ((dzUtilsRand() & 1U) || newBlockIndex == DZ_BLOCK_INVALID_ID)
-            blockIndex = dzUtilsRandRange(1U, blockCountPerDie - 1U);
-        else
-            blockIndex = newBlockIndex;
+    return DZ_RESULT_OK;
+}
 
-        badBlockCount--;
+/* Writes the page data of `die` to the snapshot in `stream`. */
+static dzResult dzDieSavePayload(const dzDie *die,
+                                 FILE *stream,
+                                 const dzDieSnapshotHeader *header) {
+    if (die == NULL || stream == NULL || header == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    if (!header->hasPayload) return DZ_RESULT_OK;
+
+    if (die->config.dataMode == DZ_DIE_DATA_MODE_FINGERPRINT) {
+        if (fwrite(die->buffer.fingerprints,
+                   sizeof *(die->buffer.fingerprints),
+                   die->metadata.pageCountPerDie,
+                   stream)
+            != die->metadata.pageCountPerDie)
+            return DZ_RESULT_IO_ERROR;
     }
 
-    return true;
-}
+    if (die->config.dataMode != DZ_DIE_DATA_MODE_FULL) return DZ_RESULT_OK;
 
-/* Creates a die buffer with the given `config` and `metadata`. */
-static dzByte *dzDieCreateBuffer(dzDieConfig config, dzDieMetadata metadata) {
-    dzByte *result = NULL;
+    for (dzU64 i = 0U; i < die->metadata.pageCountPerDie; i++) {
+        if (dzPageGetState(die->metadata.pages, i) == DZ_PAGE_STATE_FREE)
+            continue;
 
-    dzU64 bufferSize = metadata.pageCountPerDie * metadata.physicalPageSize;
+        const dzByte *pagePtr =
+            dzDieGetPageData(die,
+                             i / die->config.pageCountPerBlock,
+                             i % die->config.pageCountPerBlock);
 
-    if ((result = malloc(bufferSize * sizeof *result)) == NULL) return result;
+        if (pagePtr == NULL) continue;
 
-    // NOTE: Simulating the 'erased' state by setting all bits to `1`
-    (void) memset(result, (dzByte) 0xFF, config.pageSizeInBytes);
+        // NOTE: Each page is written as a (page index, page data) record
+        if (fwrite(&i, sizeof i, 1U, stream) != 1U
+            || fwrite(pagePtr, die->config.pageSizeInBytes, 1U, stream)
+                   != 1U)
+            return DZ_RESULT_IO_ERROR;
+    }
 
-    dzU64 pageIndex = 0U, centerPageIndex = metadata.pageCountPerDie >> 1U;
+    return DZ_RESULT_OK;
+}
 
-    dzDieForEachPage(result, metadata, pagePtr) {
-        dzF64 endurancePenalty = 1.0;
+/* Returns the size of the state of all planes and blocks in `die`. */
+static dzU64 dzDieGetStateSize(const dzDie *die) {
+    if (die == NULL) return 0U;
 
-        // NOTE: Pages in the top and bottom layers should have lower endurance
-        if (metadata.pageCountPerDie >= 2U) {
-            dzU64 distanceFromCenter = (pageIndex > centerPageIndex)
-                                           ? (pageIndex - centerPageIndex)
-                                           : (centerPageIndex - pageIndex);
+    return (die->config.planeCountPerDie
+            * dzPlaneGetStateSize(die->config.blockCountPerPlane))
+           + (die->metadata.blockCountPerDie
+              * dzBlockGetStateSize(die->config.pageCountPerBlock));
+}
 
-            dzF64 penaltyScale = ((dzF64) distanceFromCenter
-                                  / (dzF64) centerPageIndex);
+/* Reads the state of all planes and blocks in `die` from `src`. */
+static bool dzDieReadState(dzDie *die, dzByteStream *src) {
+    if (die == NULL || src == NULL) return false;
 
-            endurancePenalty -= (penaltyScale * DZ_PAGE_PE_CYCLES_MAX_PENALTY);
-        }
+    for (dzU64 i = 0U; i < die->config.planeCountPerDie; i++)
+        if (dzPlaneReadState(dzDieGetPlaneMetadata(die, i), src)
+            != DZ_RESULT_OK)
+            return false;
 
-        dzPPA physicalPageAddress = {
-            .dieId = config.dieId,
-            .planeId = pageIndex / metadata.pageCountPerPlane,
-            .blockId = (pageIndex % metadata.pageCountPerPlane)
-                       / config.pageCountPerBlock,
-            .pageId = pageIndex % config.pageCountPerBlock
-            // TODO: ...
-        };
+    for (dzU64 i = 0U; i < die->metadata.blockCountPerDie; i++)
+        if (dzBlockReadState(dzDieGetBlockMetadata(die, i), src)
+            != DZ_RESULT_OK)
+            return false;
 
-        dzPageConfig pageConfig = { .physicalPageAddress = physicalPageAddress,
-                                    .endurancePenalty = endurancePenalty,
-                                    .pageSizeInBytes = config.pageSizeInBytes,
-                                    .cellType = config.cellType };
+    return true;
+}
 
-        if (dzPageInitMetadata(pagePtr, pageConfig) != DZ_RESULT_OK) {
-            free(result);
+/* Writes the state of all planes and blocks in `die` to `dst`. */
+static bool dzDieWriteState(const dzDie *die, dzByteStream *dst) {
+    if (die == NULL || dst == NULL) return false;
 
-            return NULL;
-        }
+    for (dzU64 i = 0U; i < die->config.planeCountPerDie; i++)
+        if (dzPlaneWriteState(dzDieGetPlaneMetadata(die, i), dst)
+            != DZ_RESULT_OK)
+            return false;
 
-        pageIndex++;
-    }
+    for (dzU64 i = 0U; i < die->metadata.blockCountPerDie; i++)
+        if (dzBlockWriteState(dzDieGetBlockMetadata(die, i), dst)
+            != DZ_RESULT_OK)
+            return false;
 
-    return result;
+    return true;
 }
 
 /* 
@@ -773,7 +2474,8 @@ static dzU64 dzDieGetAdjacentBlockIndex(dzDie *die, dzU64 blockIndex) {
     else if (nextBlockIndex == DZ_BLOCK_INVALID_ID)
         return prevBlockIndex;
     else
-        return ((dzUtilsRand() & 1U) ? prevBlockIndex : nextBlockIndex);
+        return ((dzUtilsRngNext(&(die->rng)) & 1U) ? prevBlockIndex 
+                                                   : nextBlockIndex);
 
     // clang-format on
 }
@@ -784,6 +2486,15 @@ static bool dzDieInitBlockMetadata(dzDie *die) {
 
     dzPBA physicalBlockAddress = dzDieGetFirstPBA(die);
 
+    dzUSize mapRegionSize = dzBlockGetMapRegionSize(
+        die->config.pageCountPerBlock);
+
+    // NOTE: Page state maps of all blocks follow those of all planes
+    dzByte *mapRegion = die->metadata.stateMaps
+                        + (die->config.planeCountPerDie
+                           * dzPlaneGetMapRegionSize(
+                               die->config.blockCountPerPlane));
+
     for (dzU64 i = 0U; i < die->metadata.blockCountPerDie; i++) {
         dzBlockMetadata *blockMetadata = dzDieGetBlockMetadata(die, i);
 
@@ -793,7 +2504,10 @@ static bool dzDieInitBlockMetadata(dzDie *die) {
         blockConfig.pageCount = die->config.pageCountPerBlock;
         blockConfig.cellType = die->config.cellType;
 
-        if (dzBlockInitMetadata(blockMetadata, blockConfig) != DZ_RESULT_OK)
+        if (dzBlockInitMetadata(blockMetadata,
+                                mapRegion + (i * mapRegionSize),
+                                blockConfig)
+            != DZ_RESULT_OK)
             return false;
 
         physicalBlockAddress = dzDieGetNextPBA(die, physicalBlockAddress);
@@ -806,6 +2520,9 @@ static bool dzDieInitBlockMetadata(dzDie *die) {
 static bool dzDieInitPlaneMetadata(dzDie *die) {
     if (die == NULL) return false;
 
+    dzUSize mapRegionSize = dzPlaneGetMapRegionSize(
+        die->config.blockCountPerPlane);
+
     for (dzU64 i = 0U; i < die->config.planeCountPerDie; i++) {
         dzPlaneMetadata *planeMetadata = dzDieGetPlaneMetadata(die, i);
 
@@ -814,7 +2531,11 @@ static bool dzDieInitPlaneMetadata(dzDie *die) {
         planeConfig.planeId = i;
         planeConfig.blockCount = die->config.blockCountPerPlane;
 
-        if (dzPlaneInitMetadata(planeMetadata, planeConfig) != DZ_RESULT_OK)
+        if (dzPlaneInitMetadata(planeMetadata,
+                                die->metadata.stateMaps
+                                    + (i * mapRegionSize),
+                                planeConfig)
+            != DZ_RESULT_OK)
             return false;
     }
 
@@ -834,12 +2555,6 @@ static bool dzDieInitMetadata(dzDie *die) {
     die->metadata.pageCountPerPlane = die->metadata.pageCountPerDie
                                       / die->config.planeCountPerDie;
 
-    die->metadata.physicalPageSize = die->config.pageSizeInBytes
-                                     + (dzU32) dzPageGetMetadataSize();
-
-    die->metadata.physicalBlockSize = die->config.pageCountPerBlock
-                                      * die->metadata.physicalPageSize;
-
     {
         dzUSize totalPlaneMetadataSize = die->config.planeCountPerDie
                                          * dzPlaneGetMetadataSize();
@@ -847,14 +2562,33 @@ static bool dzDieInitMetadata(dzDie *die) {
         dzUSize totalBlockMetadataSize = die->metadata.blockCountPerDie
                                          * dzBlockGetMetadataSize();
 
+        dzUSize totalStateMapSize =
+            (die->config.planeCountPerDie
+             * dzPlaneGetMapRegionSize(die->config.blockCountPerPlane))
+            + (die->metadata.blockCountPerDie
+               * dzBlockGetMapRegionSize(die->config.pageCountPerBlock));
+
+        /* 
+            NOTE: All plane and block metadata (including their state maps) 
+                  are carved from a single allocation, so that they stay 
+                  contiguous and can be released at once
+        */
         dzByte *extraBuffer = malloc(totalPlaneMetadataSize
-                                     + totalBlockMetadataSize);
+                                     + totalBlockMetadataSize
+                                     + dzPageGetMetadataSize()
+                                     + totalStateMapSize);
 
         if (extraBuffer == NULL) return false;
 
         die->metadata.planes = (dzPlaneMetadata *) extraBuffer;
         die->metadata.blocks = (dzBlockMetadata *) (extraBuffer
                                                     + totalPlaneMetadataSize);
+        die->metadata.pages = (dzPageMetadata *) (extraBuffer
+                                                  + totalPlaneMetadataSize
+                                                  + totalBlockMetadataSize);
+        die->metadata.stateMaps = extraBuffer + totalPlaneMetadataSize
+                                  + totalBlockMetadataSize
+                                  + dzPageGetMetadataSize();
 
         if (!dzDieInitPlaneMetadata(die) || !dzDieInitBlockMetadata(die))
             return false;
@@ -863,22 +2597,271 @@ static bool dzDieInitMetadata(dzDie *die) {
     return true;
 }
 
+/* Initializes all page metadata in `die.` */
+static bool dzDieInitPageMetadata(dzDie *die) {
+    if (die == NULL) return false;
+
+    dzPageConfig pageConfig = { .pageCount = die->metadata.pageCountPerDie,
+                                .cellType = die->config.cellType };
+
+    return (dzPageInitMetadata(die->metadata.pages,
+                               die->metadata.pageArrays,
+                               pageConfig,
+                               &(die->rng))
+            == DZ_RESULT_OK);
+}
+
 /* Writes the contents of the ONFI parameter page to `die`. */
 static bool dzDieProgramParameterPage(dzDie *die) {
     if (die == NULL) return false;
 
-    dzByteArray firstPage = { .ptr = die->buffer,
-                              .size = die->config.pageSizeInBytes };
+    if (die->config.dataMode == DZ_DIE_DATA_MODE_FULL) {
+        dzByteArray firstPage = { .ptr = dzDieAllocPageData(die, 0U, 0U),
+                                  .size = die->config.pageSizeInBytes };
 
-    if (dzOnfiCreateParameterPage(die, firstPage) != DZ_RESULT_OK)
-        return false;
+        // NOTE: Simulating the 'erased' state by setting all bits to `1`
+        if (firstPage.ptr != NULL)
+            (void) memset(firstPage.ptr, (dzByte) 0xFF, firstPage.size);
+
+        if (dzOnfiCreateParameterPage(die, firstPage) != DZ_RESULT_OK)
+            return false;
+    }
 
-    (void) dzPageMarkAsReserved(die->buffer, die->config.pageSizeInBytes);
+    (void) dzPageMarkAsReserved(die->metadata.pages, 0U);
     (void) dzBlockMarkAsReserved(die->metadata.blocks);
 
     return true;
 }
 
+/* 
+    Writes `srcs[i].ptr` to the page corresponding to `ppas[i]` in `die`, 
+    for each of the `count` pages in the same block, and stores the result 
+    of each write in `results[i]`.
+*/
+static void dzDieProgramRun(dzDie *die,
+                            const dzPPA *ppas,
+                            const dzByteArray *srcs,
+                            dzResult *results,
+                            dzU64 count) {
+    // NOTE: The block and its plane are only looked up once per run
+    if (!dzDieIsValidPBA(die, ppas[0])) {
+        for (dzU64 i = 0U; i < count; i++)
+            results[i] = DZ_RESULT_INVALID_ARGUMENT;
+
+        return;
+    }
+
+    dzU64 blockIndex = dzDiePBAToBlockIndex(die, ppas[0]);
+
+    dzBlockMetadata *blockMetadata = dzDieGetBlockMetadata(die, blockIndex);
+
+    dzPlaneMetadata *planeMetadata = dzDieGetPlaneMetadata(die,
+                                                           ppas[0].planeId);
+
+    dzU64 programmedPageCount = 0U;
+
+    for (dzU64 i = 0U; i < count; i++) {
+        dzByteArray src = srcs[i];
+
+        // NOTE: The contents of `src` are never used in the 'dataless' mode
+        if (ppas[i].pageId >= die->config.pageCountPerBlock
+            || (die->config.dataMode != DZ_DIE_DATA_MODE_NONE
+                && (src.ptr == NULL || src.size == 0U))) {
+            results[i] = DZ_RESULT_INVALID_ARGUMENT;
+
+            continue;
+        }
+
+        // NOTE: Victim blocks can only be erased
+        if (dzBlockGetState(blockMetadata) == DZ_BLOCK_STATE_VICTIM) {
+            results[i] = DZ_RESULT_INVALID_STATE;
+
+            continue;
+        }
+
+        die->status &= (dzByte) ~DZ_DIE_STATUS_FAIL;
+
+        dzU64 pageIndex = (blockIndex * die->config.pageCountPerBlock)
+                          + ppas[i].pageId;
+
+        /*
+            NOTE: Every check is done before the state of the page changes, 
+                  so that a rejected page stays free
+        */
+
+        // NOTE: Erase-before-Write Property!
+        if (dzPageGetState(die->metadata.pages, pageIndex)
+            != DZ_PAGE_STATE_FREE) {
+            die->status |= DZ_DIE_STATUS_FAIL;
+
+            results[i] = DZ_RESULT_ALREADY_VALID;
+
+            continue;
+        }
+
+        // NOTE: Enforce "Sequential Page Programming"
+        if (ppas[i].pageId != dzBlockGetNextPageId(blockMetadata)) {
+            results[i] = DZ_RESULT_INVALID_SEQUENCE;
+
+            continue;
+        }
+
+        dzByte *pagePtr = NULL;
+
+        if (die->config.dataMode == DZ_DIE_DATA_MODE_FULL) {
+            pagePtr = dzDieAllocPageData(die, blockIndex, ppas[i].pageId);
+
+            if (pagePtr == NULL) {
+                results[i] = DZ_RESULT_NO_MEMORY;
+
+                continue;
+            }
+        }
+
+        dzF64 programLatency = -DBL_MAX;
+
+        if (dzPageMarkAsValid(die->metadata.pages,
+                              pageIndex,
+                              &(die->rng),
+                              &programLatency)
+            != DZ_RESULT_OK) {
+            results[i] = DZ_RESULT_INTERNAL_ERROR;
+
+            continue;
+        }
+
+        die->lastLatency = programLatency;
+
+        die->stats.totalProgramLatency += programLatency;
+        die->stats.totalProgramCount++;
+
+        // NOTE: The page at the write frontier of a block is always free
+        (void) dzBlockUpdatePageStateMap(blockMetadata, DZ_PAGE_STATE_VALID);
+        (void) dzBlockAdvanceNextPageId(blockMetadata);
+
+        programmedPageCount++;
+
+        results[i] = DZ_RESULT_OK;
+
+        if (src.size > die->config.pageSizeInBytes)
+            src.size = die->config.pageSizeInBytes;
+
+        if (pagePtr != NULL) {
+            (void) memcpy(pagePtr, src.ptr, src.size);
+
+            // NOTE: Only the unwritten tail is left in the 'erased' state
+            (void) memset(pagePtr + src.size,
+                          (dzByte) 0xFF,
+                          die->config.pageSizeInBytes - src.size);
+        } else if (die->config.dataMode == DZ_DIE_DATA_MODE_FINGERPRINT) {
+            die->buffer.fingerprints[pageIndex] = dzUtilsHash64(src);
+        }
+    }
+
+    if (programmedPageCount == 0U) return;
+
+    dzResult result = DZ_RESULT_OK;
+
+    /*
+        NOTE: Since at least one valid page is present in this block, 
+              it can be marked as active, and the maps of its plane 
+              only have to be updated once for the whole run
+    */
+    if (dzBlockMarkAsActive(blockMetadata) != DZ_RESULT_OK)
+        result = DZ_RESULT_INTERNAL_ERROR;
+    else if (dzPlaneUpdateBlockStateMap(planeMetadata,
+                                        ppas[0],
+                                        dzBlockGetState(blockMetadata))
+                 != DZ_RESULT_OK
+             || dzPlaneUpdatePageCounts(planeMetadata,
+                                        DZ_PAGE_STATE_FREE,
+                                        DZ_PAGE_STATE_VALID,
+                                        programmedPageCount)
+                    != DZ_RESULT_OK)
+        result = DZ_RESULT_MAP_UPDATE_FAILED;
+
+    if (result == DZ_RESULT_OK) return;
+
+    for (dzU64 i = 0U; i < count; i++)
+        if (results[i] == DZ_RESULT_OK) results[i] = result;
+}
+
+/* 
+    Reads data from the page corresponding to `ppas[i]` in `die`, 
+    and copies it to `dsts[i].ptr`, for each of the `count` pages 
+    in the same block, and stores the result of each read in `results[i]`.
+*/
+static void dzDieReadRun(dzDie *die,
+                         const dzPPA *ppas,
+                         const dzByteArray *dsts,
+                         dzResult *results,
+                         dzU64 count) {
+    // NOTE: The block is only looked up once per run
+    if (!dzDieIsValidPBA(die, ppas[0])) {
+        for (dzU64 i = 0U; i < count; i++)
+            results[i] = DZ_RESULT_INVALID_ARGUMENT;
+
+        return;
+    }
+
+    dzU64 blockIndex = dzDiePBAToBlockIndex(die, ppas[0]);
+
+    for (dzU64 i = 0U; i < count; i++) {
+        dzByteArray dst = dsts[i];
+
+        // NOTE: `dst` is never written to in the 'dataless' modes
+        if (ppas[i].pageId >= die->config.pageCountPerBlock
+            || (die->config.dataMode == DZ_DIE_DATA_MODE_FULL
+                && (dst.ptr == NULL
+                    || dst.size < die->config.pageSizeInBytes))) {
+            results[i] = DZ_RESULT_INVALID_ARGUMENT;
+
+            continue;
+        }
+
+        dzU64 pageIndex = (blockIndex * die->config.pageCountPerBlock)
+                          + ppas[i].pageId;
+
+        results[i] = dzDieSensePage(die, pageIndex);
+
+        if (results[i] != DZ_RESULT_OK
+            || die->config.dataMode != DZ_DIE_DATA_MODE_FULL)
+            continue;
+
+        const dzByte *pagePtr = dzDieGetPageData(die,
+                                                 blockIndex,
+                                                 ppas[i].pageId);
+
+        // NOTE: Pages that have never been programmed are in the erased state
+        if (pagePtr != NULL)
+            (void) memcpy(dst.ptr, pagePtr, die->config.pageSizeInBytes);
+        else
+            (void) memset(dst.ptr, (dzByte) 0xFF, die->config.pageSizeInBytes);
+    }
+}
+
+/* 
+    Senses the `pageIndex`-th page of `die` into its page register, 
+    and updates the latency statistics of `die`.
+*/
+static dzResult dzDieSensePage(dzDie *die, dzU64 pageIndex) {
+    dzF64 readLatency = -DBL_MAX;
+
+    if (dzPageGetReadLatency(die->metadata.pages,
+                             pageIndex,
+                             &(die->rng),
+                             &readLatency)
+        != DZ_RESULT_OK)
+        return DZ_RESULT_INTERNAL_ERROR;
+
+    die->lastLatency = readLatency;
+
+    die->stats.totalReadLatency += readLatency;
+    die->stats.totalReadCount++;
+
+    return DZ_RESULT_OK;
+}
+
 /* ========================================================================> */
 
 /* Returns the pointer to the `blockIndex`-th block metadata. */
@@ -892,6 +2875,48 @@ DZ_API_STATIC_INLINE dzBlockMetadata *dzDieGetBlockMetadata(const dzDie *die,
                                 + (blockIndex * dzBlockGetMetadataSize()));
 }
 
+/* Returns `true` if `refCount` is shared with other dies. */
+DZ_API_STATIC_INLINE dzBool dzDieIsShared(dzU64 *refCount) {
+    return (__atomic_load_n(refCount, __ATOMIC_ACQUIRE) > 1U);
+}
+
+/* 
+    Returns the first of the `count` results in `results` 
+    that is not `DZ_RESULT_OK`, or `DZ_RESULT_OK` if there is none.
+*/
+DZ_API_STATIC_INLINE dzResult dzDieGetFirstError(const dzResult *results,
+                                                 dzU64 count) {
+    for (dzU64 i = 0U; i < count; i++)
+        if (results[i] != DZ_RESULT_OK) return results[i];
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Returns the number of leading addresses among the `count` addresses 
+    in `ppas` that point to the same block.
+*/
+DZ_API_STATIC_INLINE dzU64 dzDieGetRunLength(const dzPPA *ppas, dzU64 count) {
+    dzU64 result = 1U;
+
+    // clang-format off
+
+    while (result < count
+           && ppas[result].dieId == ppas[0].dieId
+           && ppas[result].planeId == ppas[0].planeId
+           && ppas[result].blockId == ppas[0].blockId)
+        result++;
+
+    // clang-format on
+
+    return result;
+}
+
+/* Acquires a new reference to `refCount`. */
+DZ_API_STATIC_INLINE void dzDieRetain(dzU64 *refCount) {
+    (void) __atomic_fetch_add(refCount, 1U, __ATOMIC_RELAXED);
+}
+
 /* Returns the pointer to the `planeIndex`-th plane metadata. */
 DZ_API_STATIC_INLINE dzPlaneMetadata *dzDieGetPlaneMetadata(const dzDie *die,
                                                             dzU64 planeIndex) {
@@ -903,9 +2928,52 @@ DZ_API_STATIC_INLINE dzPlaneMetadata *dzDieGetPlaneMetadata(const dzDie *die,
                                 + (planeIndex * dzPlaneGetMetadataSize()));
 }
 
+/* 
+    Returns the pointer to the data of the `pageId`-th page 
+    in the `blockIndex`-th block, or `NULL` if it is not resident.
+*/
+DZ_API_STATIC_INLINE dzByte *dzDieGetPageData(const dzDie *die,
+                                              dzU64 blockIndex,
+                                              dzU64 pageId) {
+    if (die == NULL || blockIndex >= die->metadata.blockCountPerDie
+        || pageId >= die->config.pageCountPerBlock)
+        return NULL;
+
+    dzU64 pageIndex = (blockIndex * die->config.pageCountPerBlock) + pageId;
+
+    dzPageState pageState = dzPageGetState(die->metadata.pages, pageIndex);
+
+    /*
+        NOTE: Erases are lazy, so free pages (and bad pages left behind 
+              by a failed erase) may still hold stale data
+    */
+    if (pageState == DZ_PAGE_STATE_FREE || pageState == DZ_PAGE_STATE_BAD)
+        return NULL;
+
+    if (die->buffer.pageData != NULL)
+        return die->buffer.pageData
+               + (pageIndex * die->config.pageSizeInBytes);
+
+    if (die->buffer.pageTables == NULL) return NULL;
+
+    const dzDiePageTable *pageTable = die->buffer.pageTables[blockIndex];
+
+    if (pageTable == NULL || pageTable->pages[pageId] == NULL) return NULL;
+
+    dzDiePageData *pageData = pageTable->pages[pageId];
+
+    // NOTE: Data written before the last erase of the block are discarded
+    if (pageData->eraseCount
+        != dzBlockGetTotalEraseCount(dzDieGetBlockMetadata(die, blockIndex)))
+        return NULL;
+
+    return pageData->data;
+}
+
 /* Returns an invalid physical page address. */
 DZ_API_STATIC_INLINE dzPPA dzDieGetInvalidPPA(void) {
-    return (dzPPA) { .chipId = DZ_CHIP_INVALID_ID,
+    return (dzPPA) { .channelId = DZ_CHANNEL_INVALID_ID,
+                     .chipId = DZ_CHIP_INVALID_ID,
                      .dieId = DZ_DIE_INVALID_ID,
                      .planeId = DZ_PLANE_INVALID_ID,
                      .blockId = DZ_BLOCK_INVALID_ID,
@@ -943,15 +3011,88 @@ DZ_API_STATIC_INLINE dzBool dzDieIsValidPPA(const dzDie *die, dzPPA ppa) {
     // clang-format on
 }
 
-/* Returns the pointer to a page corresponding to `ppa` in `die`. */
-DZ_API_STATIC_INLINE dzByte *dzDiePPAToPtr(const dzDie *die, dzPPA ppa) {
-    if (!dzDieIsValidPPA(die, ppa)) return NULL;
+/* 
+    Returns `true` if `ppas` are `count` page (or block, if `isPageOp` 
+    is `false`) addresses within `die` that can be accessed with 
+    a single multi-plane operation.
+*/
+DZ_API_STATIC_INLINE dzBool dzDieIsValidMultiPlaneOp(const dzDie *die,
+                                                     const dzPPA *ppas,
+                                                     dzU64 count,
+                                                     dzBool isPageOp) {
+    if (die == NULL || ppas == NULL || count == 0U
+        || count > die->config.planeCountPerDie)
+        return false;
+
+    dzU64 planeMask = 0U;
+
+    // NOTE: One block per plane, and the same page offset in every block
+    for (dzU64 i = 0U; i < count; i++) {
+        dzBool isValidAddress = isPageOp ? dzDieIsValidPPA(die, ppas[i])
+                                         : dzDieIsValidPBA(die, ppas[i]);
+
+        if (!isValidAddress
+            || (planeMask & (UINT64_C(1) << ppas[i].planeId)) != 0U
+            || (isPageOp && ppas[i].pageId != ppas[0].pageId))
+            return false;
+
+        planeMask |= UINT64_C(1) << ppas[i].planeId;
+    }
+
+    return true;
+}
+
+/* Returns `true` if `config` is a valid die configuration. */
+DZ_API_STATIC_INLINE dzBool dzDieIsValidConfig(dzDieConfig config) {
+    // clang-format off
+
+    return (config.dieId != DZ_DIE_INVALID_ID
+            && config.cellType > DZ_CELL_TYPE_UNKNOWN
+            && config.cellType < DZ_CELL_TYPE_COUNT_
+            && config.planeCountPerDie > 0U
+            && config.planeCountPerDie <= DZ_DIE_MAX_PLANE_COUNT
+            && config.blockCountPerPlane > 0U
+            && config.pageCountPerBlock > 0U
+            && (config.pageCountPerBlock % 32U) == 0U
+            && config.pageSizeInBytes > 0U
+            && config.dataMode > DZ_DIE_DATA_MODE_UNKNOWN
+            && config.dataMode < DZ_DIE_DATA_MODE_COUNT_);
+
+    // clang-format on
+}
+
+/* 
+    Returns the fraction of the time until `time` spent busy, 
+    given the total `busyTime` and the current `readyTime`.
+*/
+DZ_API_STATIC_INLINE dzF64 dzDieComputeUtilization(dzU64 busyTime,
+                                                   dzU64 readyTime,
+                                                   dzU64 time) {
+    if (time == 0U) return 0.0;
+
+    // NOTE: Exclude the part of the current operation that lies ahead
+    dzU64 pendingTime = (readyTime > time) ? (readyTime - time) : 0U;
+
+    if (pendingTime >= busyTime) return 0.0;
+
+    return (dzF64) (busyTime - pendingTime) / (dzF64) time;
+}
+
+/* Returns `offset` rounded up to the image section alignment. */
+DZ_API_STATIC_INLINE dzU64 dzDieAlignImageOffset(dzU64 offset) {
+    return (offset + (DZ_DIE_IMAGE_SECTION_ALIGNMENT - 1U))
+           & ~(DZ_DIE_IMAGE_SECTION_ALIGNMENT - 1U);
+}
+
+/* Returns the index of the block corresponding to `pba` in `die`. */
+DZ_API_STATIC_INLINE dzU64 dzDiePBAToBlockIndex(const dzDie *die, dzPBA pba) {
+    return (pba.planeId * die->config.blockCountPerPlane) + pba.blockId;
+}
 
-    dzUSize pageSize = die->metadata.physicalPageSize;
-    dzUSize blockSize = (die->config.pageCountPerBlock * pageSize);
-    dzUSize planeSize = (die->config.blockCountPerPlane * blockSize);
+/* Returns the index of the page corresponding to `ppa` in `die`. */
+DZ_API_STATIC_INLINE dzU64 dzDiePPAToPageIndex(const dzDie *die, dzPPA ppa) {
+    if (!dzDieIsValidPPA(die, ppa)) return DZ_PAGE_INVALID_ID;
 
-    return die->buffer
-           + ((ppa.planeId * planeSize) + (ppa.blockId * blockSize)
-              + (ppa.pageId * pageSize));
+    return (dzDiePBAToBlockIndex(die, ppa) * die->config.pageCountPerBlock)
+           + ppa.pageId;
 }
@@ -0,0 +1,663 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include <string.h>
+
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// TODO: ...
+
+/* Typedefs ===============================================================> */
+
+/* A structure that represents the write frontier of a die in an FTL. */
+typedef struct dzFTLDie_ {
+    dzDie *die;
+    dzPPA activePPA;  // The next page to be programmed in the active block
+    dzU64 freeBlockCount;
+    dzU64 nextBlockIndex;  // Where the search for a free block begins
+} dzFTLDie;
+
+/* A structure that represents a page-mapped flash translation layer. */
+struct dzFTL_ {
+    dzFTLConfig config;
+    dzDieConfig dieConfig;
+    dzFTLDie *dies;  // Interleaved by channel, then by chip
+    dzU32 *l2pTable;
+    dzU32 *p2lTable;
+    dzByte *pageBuffer;
+    dzU64 dieCount;
+    dzU64 blockCountPerDie;
+    dzU64 pageCountPerDie;
+    dzU64 nextDieIndex;
+    dzU64 mappedPageCount;
+    dzU64 hostWriteCount;
+    dzU64 gcWriteCount;
+};
+
+/* Constants ==============================================================> */
+
+/* A constant that represents an unmapped (logical or physical) page. */
+static const dzU32 DZ_FTL_UNMAPPED_PAGE = UINT32_MAX;
+
+/* Private Variables ======================================================> */
+
+// TODO: ...
+
+/* Private Function Prototypes ============================================> */
+
+/* 
+    Returns the next free page of the `dieIndex`-th die in `ftl`, 
+    opening a new block (and collecting garbage unless `isGC` is `true`) 
+    if the active block is full, without moving the write frontier.
+*/
+static dzResult dzFTLAllocatePage(dzFTL *ftl,
+                                  dzU64 dieIndex,
+                                  dzBool isGC,
+                                  dzPPA *ppa);
+
+/* 
+    Opens the next free block of the `dieIndex`-th die in `ftl`, 
+    collecting garbage first unless `isGC` is `true`.
+*/
+static dzResult dzFTLOpenBlock(dzFTL *ftl, dzU64 dieIndex, dzBool isGC);
+
+/* 
+    Reclaims blocks of the `dieIndex`-th die in `ftl` until it has 
+    more free blocks than the reserved ones.
+*/
+static dzResult dzFTLCollectGarbage(dzFTL *ftl, dzU64 dieIndex);
+
+/* 
+    Finds the fully written block with the fewest valid pages 
+    in the `dieIndex`-th die of `ftl`, and stores it in `pba`.
+*/
+static dzBool dzFTLFindVictimBlock(const dzFTL *ftl,
+                                   dzU64 dieIndex,
+                                   dzPBA *pba);
+
+/* 
+    Moves all valid pages of the block corresponding to `pba` 
+    in the `dieIndex`-th die of `ftl` to free pages, and erases it.
+*/
+static dzResult dzFTLRelocateBlock(dzFTL *ftl, dzU64 dieIndex, dzPBA pba);
+
+/* Maps the `lpn`-th logical page in `ftl` to the `ppn`-th physical page. */
+static dzResult dzFTLMapPage(dzFTL *ftl, dzU64 lpn, dzU32 ppn);
+
+/* Unmaps the `lpn`-th logical page in `ftl`, invalidating its old data. */
+static dzResult dzFTLUnmapPage(dzFTL *ftl, dzU64 lpn);
+
+/* Returns the physical page address of the `ppn`-th page in `ftl`. */
+DZ_API_STATIC_INLINE dzPPA dzFTLDecodePPN(const dzFTL *ftl, dzU32 ppn);
+
+/* 
+    Returns the physical page number of `ppa` 
+    in the `dieIndex`-th die of `ftl`.
+*/
+DZ_API_STATIC_INLINE dzU32 dzFTLEncodePPA(const dzFTL *ftl,
+                                          dzU64 dieIndex,
+                                          dzPPA ppa);
+
+/* Returns the physical block address of the `blockIndex`-th block. */
+DZ_API_STATIC_INLINE dzPBA dzFTLGetPBA(const dzFTL *ftl,
+                                       dzU64 dieIndex,
+                                       dzU64 blockIndex);
+
+/* Returns an invalid physical page address. */
+DZ_API_STATIC_INLINE dzPPA dzFTLGetInvalidPPA(void);
+
+/* Public Functions =======================================================> */
+
+/* Initializes `*ftl` on top of `ssd` with the given `config`. */
+dzResult dzFTLInit(dzFTL **ftl, dzSSD *ssd, dzFTLConfig config) {
+    if (ftl == NULL || ssd == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzU32 channelCount = dzSSDGetChannelCount(ssd);
+
+    dzChannel *firstChannel = dzSSDGetChannel(ssd, 0U);
+
+    dzU32 chipCount = dzChannelGetChipCount(firstChannel);
+    dzU32 dieCount = dzChipGetDieCount(dzChannelGetChip(firstChannel, 0U));
+
+    dzDieConfig dieConfig = dzDieGetConfig(
+        dzSSDGetDie(ssd, dzSSDGetFirstPPA(ssd)));
+
+    dzU64 blockCountPerDie = (dzU64) dieConfig.planeCountPerDie
+                             * dieConfig.blockCountPerPlane;
+
+    dzU64 pageCountPerDie = blockCountPerDie * dieConfig.pageCountPerBlock;
+
+    dzU64 physicalPageCount = dzSSDGetDieCount(ssd) * pageCountPerDie;
+
+    // NOTE: Physical page numbers must fit in 32 bits
+    if (physicalPageCount == 0U || physicalPageCount >= DZ_FTL_UNMAPPED_PAGE)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    if (config.reservedBlockCount == 0U) config.reservedBlockCount = 1U;
+
+    dzFTL *newFTL = malloc(sizeof *newFTL);
+
+    if (newFTL == NULL) return DZ_RESULT_NO_MEMORY;
+
+    {
+        newFTL->dieConfig = dieConfig;
+
+        newFTL->dies = calloc(dzSSDGetDieCount(ssd), sizeof *(newFTL->dies));
+
+        newFTL->pageBuffer = malloc(dieConfig.pageSizeInBytes);
+
+        newFTL->l2pTable = newFTL->p2lTable = NULL;
+
+        newFTL->dieCount = dzSSDGetDieCount(ssd);
+
+        newFTL->blockCountPerDie = blockCountPerDie;
+        newFTL->pageCountPerDie = pageCountPerDie;
+
+        newFTL->nextDieIndex = 0U;
+
+        newFTL->mappedPageCount = 0U;
+
+        newFTL->hostWriteCount = newFTL->gcWriteCount = 0U;
+    }
+
+    if (newFTL->dies == NULL || newFTL->pageBuffer == NULL) {
+        dzFTLDeinit(newFTL);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    dzU64 maxLogicalPageCount = 0U;
+
+    {
+        dzU64 dieIndex = 0U;
+
+        // NOTE: Consecutive writes are striped across channels first
+        for (dzU32 k = 0U; k < dieCount; k++) {
+            for (dzU32 j = 0U; j < chipCount; j++) {
+                for (dzU32 i = 0U; i < channelCount; i++, dieIndex++) {
+                    dzFTLDie *ftlDie = &(newFTL->dies[dieIndex]);
+
+                    ftlDie->activePPA = (dzPPA) {
+                        .channelId = i,
+                        .chipId = j,
+                        .dieId = k,
+                        .pageId = dieConfig.pageCountPerBlock
+                    };
+
+                    ftlDie->die = dzSSDGetDie(ssd, ftlDie->activePPA);
+
+                    for (dzU64 l = 0U; l < blockCountPerDie; l++) {
+                        dzPBA pba = dzFTLGetPBA(newFTL, dieIndex, l);
+
+                        if (dzDieGetBlockState(ftlDie->die, pba)
+                            == DZ_BLOCK_STATE_FREE)
+                            ftlDie->freeBlockCount++;
+                    }
+
+                    /*
+                        NOTE: One more block per die is left unmapped, 
+                              so that every die has a victim block 
+                              with at least one invalid page
+                    */
+                    if (ftlDie->freeBlockCount
+                        > config.reservedBlockCount + 1U)
+                        maxLogicalPageCount += (ftlDie->freeBlockCount
+                                                - config.reservedBlockCount
+                                                - 1U)
+                                               * dieConfig.pageCountPerBlock;
+                }
+            }
+        }
+    }
+
+    if (config.logicalPageCount == 0U)
+        config.logicalPageCount = maxLogicalPageCount;
+
+    if (config.logicalPageCount == 0U
+        || config.logicalPageCount > maxLogicalPageCount) {
+        dzFTLDeinit(newFTL);
+
+        return DZ_RESULT_INVALID_ARGUMENT;
+    }
+
+    newFTL->config = config;
+
+    {
+        /*
+            NOTE: Both tables share a single allocation, and hold packed 
+                  32-bit page numbers instead of `dzPPA`s
+        */
+        newFTL->l2pTable = malloc((config.logicalPageCount + physicalPageCount)
+                                  * sizeof *(newFTL->l2pTable));
+
+        if (newFTL->l2pTable == NULL) {
+            dzFTLDeinit(newFTL);
+
+            return DZ_RESULT_NO_MEMORY;
+        }
+
+        newFTL->p2lTable = newFTL->l2pTable + config.logicalPageCount;
+
+        (void) memset(newFTL->l2pTable,
+                      (dzByte) 0xFF,
+                      (config.logicalPageCount + physicalPageCount)
+                          * sizeof *(newFTL->l2pTable));
+    }
+
+    *ftl = newFTL;
+
+    return DZ_RESULT_OK;
+}
+
+/* Releases the memory allocated for `ftl`. */
+void dzFTLDeinit(dzFTL *ftl) {
+    if (ftl == NULL) return;
+
+    // NOTE: The SSD is owned by the caller
+    free(ftl->dies), free(ftl->l2pTable), free(ftl->pageBuffer), free(ftl);
+}
+
+/* ========================================================================> */
+
+/* Returns the number of logical pages in `ftl`. */
+dzU64 dzFTLGetLogicalPageCount(const dzFTL *ftl) {
+    return (ftl != NULL) ? ftl->config.logicalPageCount : 0U;
+}
+
+/* Returns the number of logical pages mapped to physical pages in `ftl`. */
+dzU64 dzFTLGetMappedPageCount(const dzFTL *ftl) {
+    return (ftl != NULL) ? ftl->mappedPageCount : 0U;
+}
+
+/* 
+    Returns the physical page address that the `lpn`-th logical page 
+    in `ftl` is mapped to, or an invalid address if it is not mapped.
+*/
+dzPPA dzFTLGetPPA(const dzFTL *ftl, dzU64 lpn) {
+    if (ftl == NULL || lpn >= ftl->config.logicalPageCount
+        || ftl->l2pTable[lpn] == DZ_FTL_UNMAPPED_PAGE)
+        return dzFTLGetInvalidPPA();
+
+    return dzFTLDecodePPN(ftl, ftl->l2pTable[lpn]);
+}
+
+/* 
+    Returns the ratio of pages programmed by `ftl` (including garbage 
+    collection) to pages written by the host, or `0.0` if there are none.
+*/
+dzF64 dzFTLGetWriteAmplification(const dzFTL *ftl) {
+    if (ftl == NULL || ftl->hostWriteCount == 0U) return 0.0;
+
+    return (dzF64) (ftl->hostWriteCount + ftl->gcWriteCount)
+           / (dzF64) ftl->hostWriteCount;
+}
+
+/* ========================================================================> */
+
+/* 
+    Writes `src.ptr` to a free physical page in `ftl`, and maps 
+    the `lpn`-th logical page to it (out-of-place write).
+*/
+dzResult dzFTLWritePage(dzFTL *ftl, dzU64 lpn, dzByteArray src) {
+    if (ftl == NULL || lpn >= ftl->config.logicalPageCount)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: A page must never be allocated for a write that would fail
+    if (ftl->dieConfig.dataMode != DZ_DIE_DATA_MODE_NONE
+        && (src.ptr == NULL || src.size == 0U))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzResult result = DZ_RESULT_NO_SPACE;
+
+    // NOTE: A die without any reclaimable block is skipped
+    for (dzU64 i = 0U; i < ftl->dieCount; i++) {
+        dzU64 dieIndex = ftl->nextDieIndex;
+
+        ftl->nextDieIndex = (ftl->nextDieIndex + 1U) % ftl->dieCount;
+
+        dzPPA ppa = dzFTLGetInvalidPPA();
+
+        result = dzFTLAllocatePage(ftl, dieIndex, false, &ppa);
+
+        if (result == DZ_RESULT_NO_SPACE) continue;
+
+        if (result != DZ_RESULT_OK) return result;
+
+        result = dzDieProgramPage(ftl->dies[dieIndex].die, ppa, src);
+
+        if (result != DZ_RESULT_OK) return result;
+
+        // NOTE: The write frontier only moves past successfully written pages
+        ftl->dies[dieIndex].activePPA.pageId++;
+
+        ftl->hostWriteCount++;
+
+        return dzFTLMapPage(ftl, lpn, dzFTLEncodePPA(ftl, dieIndex, ppa));
+    }
+
+    return result;
+}
+
+/* 
+    Reads data from the physical page that the `lpn`-th logical page 
+    in `ftl` is mapped to, and copies it to `dst.ptr`.
+*/
+dzResult dzFTLReadPage(dzFTL *ftl, dzU64 lpn, dzByteArray dst) {
+    if (ftl == NULL || lpn >= ftl->config.logicalPageCount)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzU32 ppn = ftl->l2pTable[lpn];
+
+    // NOTE: Unmapped (never written or trimmed) pages are read as erased
+    if (ppn == DZ_FTL_UNMAPPED_PAGE) {
+        if (dst.ptr != NULL)
+            (void) memset(dst.ptr,
+                          (dzByte) 0xFF,
+                          (dst.size < ftl->dieConfig.pageSizeInBytes)
+                              ? dst.size
+                              : ftl->dieConfig.pageSizeInBytes);
+
+        return DZ_RESULT_OK;
+    }
+
+    return dzDieReadPage(ftl->dies[ppn / ftl->pageCountPerDie].die,
+                         dzFTLDecodePPN(ftl, ppn),
+                         dst);
+}
+
+/* 
+    Unmaps the `lpn`-th logical page in `ftl`, so that its physical page 
+    can be reclaimed by garbage collection.
+*/
+dzResult dzFTLTrimPage(dzFTL *ftl, dzU64 lpn) {
+    if (ftl == NULL || lpn >= ftl->config.logicalPageCount)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    return dzFTLUnmapPage(ftl, lpn);
+}
+
+/* Private Functions ======================================================> */
+
+/* 
+    Returns the next free page of the `dieIndex`-th die in `ftl`, 
+    opening a new block (and collecting garbage unless `isGC` is `true`) 
+    if the active block is full, without moving the write frontier.
+*/
+static dzResult dzFTLAllocatePage(dzFTL *ftl,
+                                  dzU64 dieIndex,
+                                  dzBool isGC,
+                                  dzPPA *ppa) {
+    dzFTLDie *ftlDie = &(ftl->dies[dieIndex]);
+
+    if (ftlDie->activePPA.pageId >= ftl->dieConfig.pageCountPerBlock) {
+        dzResult result = dzFTLOpenBlock(ftl, dieIndex, isGC);
+
+        if (result != DZ_RESULT_OK) return result;
+    }
+
+    // NOTE: Pages within a block are always programmed in order
+    *ppa = ftlDie->activePPA;
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Opens the next free block of the `dieIndex`-th die in `ftl`, 
+    collecting garbage first unless `isGC` is `true`.
+*/
+static dzResult dzFTLOpenBlock(dzFTL *ftl, dzU64 dieIndex, dzBool isGC) {
+    dzFTLDie *ftlDie = &(ftl->dies[dieIndex]);
+
+    if (!isGC && ftlDie->freeBlockCount <= ftl->config.reservedBlockCount) {
+        dzResult result = dzFTLCollectGarbage(ftl, dieIndex);
+
+        if (result != DZ_RESULT_OK) return result;
+
+        // NOTE: Relocated pages may have opened a new block already
+        if (ftlDie->activePPA.pageId < ftl->dieConfig.pageCountPerBlock)
+            return DZ_RESULT_OK;
+    }
+
+    // NOTE: Free blocks are taken in a round-robin order to spread wear
+    for (dzU64 i = 0U; i < ftl->blockCountPerDie; i++) {
+        if (ftlDie->freeBlockCount == 0U) break;
+
+        dzU64 blockIndex = (ftlDie->nextBlockIndex + i)
+                           % ftl->blockCountPerDie;
+
+        dzPBA pba = dzFTLGetPBA(ftl, dieIndex, blockIndex);
+
+        if (dzDieGetBlockState(ftlDie->die, pba) != DZ_BLOCK_STATE_FREE)
+            continue;
+
+        ftlDie->activePPA = pba, ftlDie->activePPA.pageId = 0U;
+
+        ftlDie->nextBlockIndex = blockIndex + 1U;
+
+        ftlDie->freeBlockCount--;
+
+        return DZ_RESULT_OK;
+    }
+
+    return DZ_RESULT_NO_SPACE;
+}
+
+/* 
+    Reclaims blocks of the `dieIndex`-th die in `ftl` until it has 
+    more free blocks than the reserved ones.
+*/
+static dzResult dzFTLCollectGarbage(dzFTL *ftl, dzU64 dieIndex) {
+    while (ftl->dies[dieIndex].freeBlockCount
+           <= ftl->config.reservedBlockCount) {
+        dzPBA pba = dzFTLGetInvalidPPA();
+
+        if (!dzFTLFindVictimBlock(ftl, dieIndex, &pba))
+            return DZ_RESULT_NO_SPACE;
+
+        dzResult result = dzFTLRelocateBlock(ftl, dieIndex, pba);
+
+        if (result != DZ_RESULT_OK) return result;
+    }
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Finds the fully written block with the fewest valid pages 
+    in the `dieIndex`-th die of `ftl`, and stores it in `pba`.
+*/
+static dzBool dzFTLFindVictimBlock(const dzFTL *ftl,
+                                   dzU64 dieIndex,
+                                   dzPBA *pba) {
+    const dzFTLDie *ftlDie = &(ftl->dies[dieIndex]);
+
+    dzU64 minValidPageCount = ftl->dieConfig.pageCountPerBlock;
+
+    for (dzU64 i = 0U; i < ftl->blockCountPerDie; i++) {
+        dzPBA victimPBA = dzFTLGetPBA(ftl, dieIndex, i);
+
+        // NOTE: The active block is not fully written yet
+        if (ftlDie->activePPA.pageId < ftl->dieConfig.pageCountPerBlock
+            && victimPBA.planeId == ftlDie->activePPA.planeId
+            && victimPBA.blockId == ftlDie->activePPA.blockId)
+            continue;
+
+        dzBlockState blockState = dzDieGetBlockState(ftlDie->die, victimPBA);
+
+        // NOTE: A victim left behind by a failed relocation is retried
+        if (blockState != DZ_BLOCK_STATE_ACTIVE
+            && blockState != DZ_BLOCK_STATE_VICTIM)
+            continue;
+
+        dzU64 validPageCount = dzDieGetBlockValidPageCount(ftlDie->die,
+                                                           victimPBA);
+
+        // NOTE: Greedy policy, which reclaims the most invalid pages
+        if (validPageCount < minValidPageCount)
+            minValidPageCount = validPageCount, *pba = victimPBA;
+    }
+
+    return minValidPageCount < ftl->dieConfig.pageCountPerBlock;
+}
+
+/* 
+    Moves all valid pages of the block corresponding to `pba` 
+    in the `dieIndex`-th die of `ftl` to free pages, and erases it.
+*/
+static dzResult dzFTLRelocateBlock(dzFTL *ftl, dzU64 dieIndex, dzPBA pba) {
+    dzFTLDie *ftlDie = &(ftl->dies[dieIndex]);
+
+    dzResult result = DZ_RESULT_OK;
+
+    if (dzDieGetBlockState(ftlDie->die, pba) == DZ_BLOCK_STATE_ACTIVE) {
+        result = dzDieMarkBlockAsVictim(ftlDie->die, pba);
+
+        if (result != DZ_RESULT_OK) return result;
+    }
+
+    dzByteArray pageBuffer = { .ptr = ftl->pageBuffer,
+                               .size = ftl->dieConfig.pageSizeInBytes };
+
+    for (dzU64 i = 0U; i < ftl->dieConfig.pageCountPerBlock; i++) {
+        dzPPA ppa = pba;
+
+        ppa.pageId = i;
+
+        dzU64 lpn = ftl->p2lTable[dzFTLEncodePPA(ftl, dieIndex, ppa)];
+
+        if (lpn == DZ_FTL_UNMAPPED_PAGE) continue;
+
+        dzPPA newPPA = dzFTLGetInvalidPPA();
+
+        /*
+            NOTE: Valid pages are moved within the same die, 
+                  and may use up the reserved blocks
+        */
+        result = dzFTLAllocatePage(ftl, dieIndex, true, &newPPA);
+
+        if (result != DZ_RESULT_OK) return result;
+
+        result = dzDieReadPage(ftlDie->die, ppa, pageBuffer);
+
+        if (result != DZ_RESULT_OK) return result;
+
+        result = dzDieProgramPage(ftlDie->die, newPPA, pageBuffer);
+
+        if (result != DZ_RESULT_OK) return result;
+
+        ftlDie->activePPA.pageId++;
+
+        ftl->gcWriteCount++;
+
+        result = dzFTLMapPage(ftl,
+                              lpn,
+                              dzFTLEncodePPA(ftl, dieIndex, newPPA));
+
+        if (result != DZ_RESULT_OK) return result;
+    }
+
+    // NOTE: A block that fails to be erased is marked as bad by the die
+    if (dzDieEraseBlock(ftlDie->die, pba) == DZ_RESULT_OK)
+        ftlDie->freeBlockCount++;
+
+    return DZ_RESULT_OK;
+}
+
+/* Maps the `lpn`-th logical page in `ftl` to the `ppn`-th physical page. */
+static dzResult dzFTLMapPage(dzFTL *ftl, dzU64 lpn, dzU32 ppn) {
+    dzResult result = dzFTLUnmapPage(ftl, lpn);
+
+    ftl->l2pTable[lpn] = ppn, ftl->p2lTable[ppn] = (dzU32) lpn;
+
+    ftl->mappedPageCount++;
+
+    return result;
+}
+
+/* Unmaps the `lpn`-th logical page in `ftl`, invalidating its old data. */
+static dzResult dzFTLUnmapPage(dzFTL *ftl, dzU64 lpn) {
+    dzU32 ppn = ftl->l2pTable[lpn];
+
+    if (ppn == DZ_FTL_UNMAPPED_PAGE) return DZ_RESULT_OK;
+
+    ftl->l2pTable[lpn] = ftl->p2lTable[ppn] = DZ_FTL_UNMAPPED_PAGE;
+
+    ftl->mappedPageCount--;
+
+    return dzDieInvalidatePage(ftl->dies[ppn / ftl->pageCountPerDie].die,
+                               dzFTLDecodePPN(ftl, ppn));
+}
+
+/* Returns the physical page address of the `ppn`-th page in `ftl`. */
+DZ_API_STATIC_INLINE dzPPA dzFTLDecodePPN(const dzFTL *ftl, dzU32 ppn) {
+    dzU64 pageIndex = ppn % ftl->pageCountPerDie;
+
+    dzPPA result = dzFTLGetPBA(ftl,
+                               ppn / ftl->pageCountPerDie,
+                               pageIndex / ftl->dieConfig.pageCountPerBlock);
+
+    result.pageId = pageIndex % ftl->dieConfig.pageCountPerBlock;
+
+    return result;
+}
+
+/* 
+    Returns the physical page number of `ppa` 
+    in the `dieIndex`-th die of `ftl`.
+*/
+DZ_API_STATIC_INLINE dzU32 dzFTLEncodePPA(const dzFTL *ftl,
+                                          dzU64 dieIndex,
+                                          dzPPA ppa) {
+    dzU64 blockIndex = (ppa.planeId * ftl->dieConfig.blockCountPerPlane)
+                       + ppa.blockId;
+
+    return (dzU32) ((dieIndex * ftl->pageCountPerDie)
+                    + (blockIndex * ftl->dieConfig.pageCountPerBlock)
+                    + ppa.pageId);
+}
+
+/* Returns the physical block address of the `blockIndex`-th block. */
+DZ_API_STATIC_INLINE dzPBA dzFTLGetPBA(const dzFTL *ftl,
+                                       dzU64 dieIndex,
+                                       dzU64 blockIndex) {
+    dzPBA result = ftl->dies[dieIndex].activePPA;
+
+    result.planeId = blockIndex / ftl->dieConfig.blockCountPerPlane;
+    result.blockId = blockIndex % ftl->dieConfig.blockCountPerPlane;
+    result.pageId = 0U;
+
+    return result;
+}
+
+/* Returns an invalid physical page address. */
+DZ_API_STATIC_INLINE dzPPA dzFTLGetInvalidPPA(void) {
+    return (dzPPA) { .channelId = DZ_CHANNEL_INVALID_ID,
+                     .chipId = DZ_CHIP_INVALID_ID,
+                     .dieId = DZ_DIE_INVALID_ID,
+                     .planeId = DZ_PLANE_INVALID_ID,
+                     .blockId = DZ_BLOCK_INVALID_ID,
+                     .pageId = DZ_PAGE_INVALID_ID };
+}
@@ -55,6 +55,19 @@ static const dzUSize DZ_ONFI_PARAMETER_PAGE_SIZE = 256U;
 /* ONFI revision number which includes support for ONFI version 1.0. */
 static const dzU16 DZ_ONFI_REVISION_NUMBER = 0x0002U;
 
+/* "Supports interleaved (multi-plane) operations" bit of the features. */
+static const dzU16 DZ_ONFI_FEATURE_INTERLEAVED_OPS = 0x0008U;
+
+/* "Supports Page Cache Program" bit of the optional commands. */
+static const dzU16 DZ_ONFI_OPTIONAL_PAGE_CACHE_PROGRAM = 0x0001U;
+
+/* "Supports Read Cache" bit of the optional commands. */
+static const dzU16 DZ_ONFI_OPTIONAL_READ_CACHE = 0x0002U;
+
+/* Read/write cycle times of timing modes 0 to 5, in nanoseconds. */
+static const dzU32 DZ_ONFI_TIMING_MODE_CYCLE_TIMES[] = { 100U, 50U, 35U,
+                                                          30U,  25U, 20U };
+
 /* Private Variables ======================================================> */
 
 /* Signature bytes for a valid ONFI parameter page. */
@@ -96,13 +109,17 @@ DZ_API_STATIC_INLINE void dzOnfiWriteDword(dzByteStream *dst, dzU32 value);
 /* Writes `size` zeroes to `dst->ptr` and advances `dst->offset`. */
 DZ_API_STATIC_INLINE void dzOnfiWriteZeroes(dzByteStream *dst, dzU64 size);
 
+/* Returns the timing modes that the I/O cycle time of `die` can meet. */
+DZ_API_STATIC_INLINE dzU16 dzOnfiGetTimingModes(const dzDie *die);
+
 /* ========================================================================> */
 
 /* 
     Writes the "Revision Information and Features" section of a parameter page 
     to `dst->ptr` and advances `dst->offset`.
 */
-DZ_API_STATIC_INLINE void dzOnfiWriteRIFSection(dzByteStream *dst);
+DZ_API_STATIC_INLINE void dzOnfiWriteRIFSection(const dzDie *die,
+                                                dzByteStream *dst);
 
 /* 
     Writes the "Manufacturer Information" section of a parameter page 
@@ -146,7 +163,7 @@ dzResult dzOnfiCreateParameterPage(const dzDie *die, dzByteArray dst) {
     dzByteStream stream = { .ptr = dst.ptr, .size = dst.size };
 
     for (dzU32 i = 0U; i < totalPageCount; i++) {
-        dzOnfiWriteRIFSection(&stream);
+        dzOnfiWriteRIFSection(die, &stream);
         dzOnfiWriteMISection(&stream);
 
         dzOnfiWriteMOSection(die, &stream);
@@ -158,6 +175,18 @@ dzResult dzOnfiCreateParameterPage(const dzDie *die, dzByteArray dst) {
     return DZ_RESULT_OK;
 }
 
+/* 
+    Returns the read/write cycle time of the ONFI `timingMode`, 
+    in nanoseconds, or `0` if `timingMode` is not valid.
+*/
+dzU32 dzOnfiGetCycleTime(dzU32 timingMode) {
+    if (timingMode >= (sizeof DZ_ONFI_TIMING_MODE_CYCLE_TIMES
+                       / sizeof *DZ_ONFI_TIMING_MODE_CYCLE_TIMES))
+        return 0U;
+
+    return DZ_ONFI_TIMING_MODE_CYCLE_TIMES[timingMode];
+}
+
 /* Private Functions ======================================================> */
 
 /* Writes 1 byte to `dst->ptr` and advances `dst->offset`. */
@@ -216,13 +245,32 @@ DZ_API_STATIC_INLINE void dzOnfiWriteZeroes(dzByteStream *dst, dzU64 size) {
     dst->offset += size;
 }
 
+/* Returns the timing modes that the I/O cycle time of `die` can meet. */
+DZ_API_STATIC_INLINE dzU16 dzOnfiGetTimingModes(const dzDie *die) {
+    dzU32 ioCycleTime = dzDieGetConfig(die).ioCycleTime;
+
+    // NOTE: Support for Timing Mode 0 should always be present
+    dzU16 timingModes = 0x0001U;
+
+    for (dzU16 i = 1U; i < (sizeof DZ_ONFI_TIMING_MODE_CYCLE_TIMES
+                            / sizeof *DZ_ONFI_TIMING_MODE_CYCLE_TIMES);
+         i++)
+        if (ioCycleTime <= DZ_ONFI_TIMING_MODE_CYCLE_TIMES[i])
+            timingModes |= (dzU16) (1U << i);
+
+    return timingModes;
+}
+
 /* ========================================================================> */
 
 /* 
     Writes the "Revision Information and Features" section 
     of an ONFI parameter page to `dst->ptr` and advances `dst->offset`.
 */
-DZ_API_STATIC_INLINE void dzOnfiWriteRIFSection(dzByteStream *dst) {
+DZ_API_STATIC_INLINE void dzOnfiWriteRIFSection(const dzDie *die,
+                                                dzByteStream *dst) {
+    dzDieConfig dieConfig = dzDieGetConfig(die);
+
     /* "Parameter Page Signature" */
     dzOnfiWriteBytes(dst,
                      (dzByteArray) {
@@ -235,12 +283,17 @@ DZ_API_STATIC_INLINE void dzOnfiWriteRIFSection(dzByteStream *dst) {
     /* "Features Supported" */
 
     // TODO: More features?
-    dzOnfiWriteWord(dst, 0x0000U);
+    dzOnfiWriteWord(dst,
+                    (dieConfig.planeCountPerDie > 1U)
+                        ? DZ_ONFI_FEATURE_INTERLEAVED_OPS
+                        : 0x0000U);
 
     /* "Optional Commands Supported" */
 
     // TODO: More optional commands?
-    dzOnfiWriteWord(dst, 0x0000U);
+    dzOnfiWriteWord(dst,
+                    DZ_ONFI_OPTIONAL_PAGE_CACHE_PROGRAM
+                        | DZ_ONFI_OPTIONAL_READ_CACHE);
 
     /* "Reserved" */
     dzOnfiWriteZeroes(dst, 22U);
@@ -287,7 +340,7 @@ DZ_API_STATIC_INLINE void dzOnfiWriteMOSection(const dzDie *die,
     dzOnfiWriteDword(dst, dieConfig.pageSizeInBytes);
 
     /* "Number of Spare Bytes per Page" */
-    dzOnfiWriteWord(dst, (dzU16) dzPageGetMetadataSize());
+    dzOnfiWriteWord(dst, (dzU16) dzPageGetSpareSize());
 
     /* "Number of Data Bytes per Partial Page" */
     dzOnfiWriteDword(dst, 0x00000000U);
@@ -353,8 +406,16 @@ DZ_API_STATIC_INLINE void dzOnfiWriteMOSection(const dzDie *die,
     // TODO: Implement ECC?
     dzOnfiWriteByte(dst, 0x00U);
 
-    /* "Number of Interleaved Address Bits" */
-    dzOnfiWriteByte(dst, 0x00U);
+    {
+        /* "Number of Interleaved Address Bits" */
+
+        dzByte interleavedAddressBits = 0U;
+
+        while ((1U << interleavedAddressBits) < dieConfig.planeCountPerDie)
+            interleavedAddressBits++;
+
+        dzOnfiWriteByte(dst, interleavedAddressBits);
+    }
 
     /* "Interleaved Operation Attributes" */
     dzOnfiWriteByte(dst, 0x00U);
@@ -373,14 +434,10 @@ DZ_API_STATIC_INLINE void dzOnfiWriteEPSection(const dzDie *die,
     dzOnfiWriteByte(dst, DZ_ONFI_IO_PIN_CAPACITANCE);
 
     /* "Timing Mode Support" */
-
-    // NOTE: Support for Timing Mode 0 should always be present
-    dzOnfiWriteWord(dst, 0x0001U);
+    dzOnfiWriteWord(dst, dzOnfiGetTimingModes(die));
 
     /* "Program Cache Timing Mode Support" */
-
-    // TODO: Implement program cache?
-    dzOnfiWriteWord(dst, 0x0000U);
+    dzOnfiWriteWord(dst, dzOnfiGetTimingModes(die));
 
     {
         /* "Maximum Page Program Time" */
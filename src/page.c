@@ -22,27 +22,34 @@
 
 /* Includes ===============================================================> */
 
+#include <string.h>
+
 #include "ssdeez.h"
 
 /* Macros =================================================================> */
 
-// TODO: ...
+#define DZ_PAGE_SAMPLE_BATCH_SIZE  256U
 
 /* Typedefs ===============================================================> */
 
-/* A structure that represents the metadata of a NAND flash page. */
+/* 
+    A structure that represents the metadata of all NAND flash pages 
+    within a die, stored as hot and cold arrays indexed by page.
+*/
 struct dzPageMetadata_ {
-    dzU32 factoryMarker;
-    dzPageState state;
-    dzPPA physicalPageAddress;
-    dzU64 totalProgramCount;
-    dzU64 totalReadCount;
-    // dzF64 lastProgramTime;
-    // dzF64 lastReadTime;
+    /* Hot Arrays (accessed on every operation) */
+    dzU64 *programCounts;
+    dzU64 *readCounts;
+    dzU32 *peCycles;
+    dzI8 *states;
+    /* Cold Arrays (accessed on erase or bad block management only) */
+    dzU32 *maxPeCycles;
+    dzByte *factoryMarkers;
+    // dzF64 *lastProgramTimes;
+    // dzF64 *lastReadTimes;
+    dzU64 pageCount;
     dzF64 maxProgramLatency;
     dzF64 maxReadLatency;
-    dzU32 maxPeCycles;
-    dzU32 peCycles;
     dzCellType cellType;
 };
 
@@ -81,82 +88,131 @@ const dzU64 DZ_PAGE_INVALID_ID = UINT64_MAX;
 
 /* Private Function Prototypes ============================================> */
 
+/* Places the per-page arrays of `metadata` in `arrayRegion`. */
+static void dzPageBindArrays(dzPageMetadata *metadata,
+                             dzByte *arrayRegion,
+                             dzPageConfig config);
+
+/* Returns the endurance penalty of the `pageIndex`-th page. */
+DZ_API_STATIC_INLINE dzF64 dzPageGetEndurancePenalty(dzU64 pageIndex,
+                                                     dzU64 pageCount);
+
 /* Returns `true` if `cellType` is a valid NAND flash cell type. */
 DZ_API_STATIC_INLINE bool dzIsValidCellType(dzCellType cellType);
 
+/* Returns `true` if `pageIndex` is a valid page index within `metadata`. */
+DZ_API_STATIC_INLINE bool dzIsValidPageIndex(const dzPageMetadata *metadata,
+                                             dzU64 pageIndex);
+
 /* Public Functions =======================================================> */
 
-/* Initializes a page metadata object within the given `pagePtr`. */
-dzResult dzPageInitMetadata(dzByte *pagePtr, dzPageConfig config) {
-    if (pagePtr == NULL || !dzIsValidCellType(config.cellType)
-        || config.pageSizeInBytes == 0U)
+/* 
+    Initializes a page `metadata` within the given region, 
+    placing its per-page arrays in `arrayRegion` and drawing 
+    the endurance of each page from `rng`.
+*/
+dzResult dzPageInitMetadata(dzPageMetadata *metadata,
+                            dzByte *arrayRegion,
+                            dzPageConfig config,
+                            dzRng *rng) {
+    if (metadata == NULL || arrayRegion == NULL || config.pageCount == 0U
+        || !dzIsValidCellType(config.cellType))
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    dzPageMetadata *pageMetadata =
-        (dzPageMetadata *) (pagePtr + config.pageSizeInBytes);
+    dzPageBindArrays(metadata, arrayRegion, config);
 
-    {
-        pageMetadata->factoryMarker = 0x12345678;
+    (void) memset(metadata->programCounts,
+                  0,
+                  config.pageCount * sizeof *(metadata->programCounts));
 
-        pageMetadata->state = DZ_PAGE_STATE_FREE;
+    (void) memset(metadata->readCounts,
+                  0,
+                  config.pageCount * sizeof *(metadata->readCounts));
 
-        pageMetadata->physicalPageAddress = config.physicalPageAddress;
+    (void) memset(metadata->states,
+                  DZ_PAGE_STATE_FREE,
+                  config.pageCount * sizeof *(metadata->states));
 
-        pageMetadata->totalProgramCount = 0U;
-        pageMetadata->totalReadCount = 0U;
+    (void) memset(metadata->factoryMarkers,
+                  0xFF,
+                  config.pageCount * sizeof *(metadata->factoryMarkers));
 
-        // pageMetadata->lastProgramTime = 0.0;
-        // pageMetadata->lastReadTime = 0.0;
+    dzF64 meanPeCycles = peCyclesTable[config.cellType];
 
-        pageMetadata->cellType = config.cellType;
-    }
+    // NOTE: The endurance of all pages is drawn in batches
+    for (dzU64 i = 0U; i < config.pageCount; i += DZ_PAGE_SAMPLE_BATCH_SIZE) {
+        dzF64 samples[DZ_PAGE_SAMPLE_BATCH_SIZE];
 
-    {
-        dzF64 programLatencyMu = programLatencyTable[pageMetadata->cellType];
-        dzF64 programLatencySigma = DZ_PAGE_PROGRAM_LATENCY_STDDEV_RATIO
-                                    * programLatencyMu;
+        dzU64 sampleCount = config.pageCount - i;
 
-        pageMetadata->maxProgramLatency = programLatencyMu
-                                          + (3.0 * programLatencySigma);
+        if (sampleCount > DZ_PAGE_SAMPLE_BATCH_SIZE)
+            sampleCount = DZ_PAGE_SAMPLE_BATCH_SIZE;
 
-        dzF64 readLatencyMu = readLatencyTable[pageMetadata->cellType];
-        dzF64 readLatencySigma = DZ_PAGE_READ_LATENCY_STDDEV_RATIO
-                                 * readLatencyMu;
+        dzUtilsRngGaussianFill(rng,
+                               samples,
+                               sampleCount,
+                               meanPeCycles,
+                               DZ_PAGE_PE_CYCLE_COUNT_STDDEV_RATIO
+                                   * meanPeCycles);
 
-        pageMetadata->maxReadLatency = readLatencyMu
-                                       + (3.0 * readLatencySigma);
-    }
+        for (dzU64 j = 0U; j < sampleCount; j++) {
+            dzU32 maxPeCycles = (dzU32) samples[j];
 
-    {
-        // clang-format off
+            maxPeCycles = (dzU32) (dzPageGetEndurancePenalty(i + j,
+                                                             config.pageCount)
+                                   * maxPeCycles);
 
-        pageMetadata->maxPeCycles = (dzU32) dzUtilsGaussian(
-            peCyclesTable[config.cellType], 
-            DZ_PAGE_PE_CYCLE_COUNT_STDDEV_RATIO 
-                * peCyclesTable[config.cellType]
-        );
-
-        if (config.endurancePenalty < 0.0) config.endurancePenalty = 0.0;
+            metadata->maxPeCycles[i + j] = metadata->peCycles[i + j] =
+                maxPeCycles;
+        }
+    }
 
-        pageMetadata->maxPeCycles = (dzU32) (config.endurancePenalty
-                                           * pageMetadata->maxPeCycles);
+    return DZ_RESULT_OK;
+}
 
-        // clang-format on
+/* 
+    Initializes a page `metadata` within the given region, 
+    reusing the per-page arrays already stored in `arrayRegion`.
+*/
+dzResult dzPageLoadMetadata(dzPageMetadata *metadata,
+                            dzByte *arrayRegion,
+                            dzPageConfig config) {
+    if (metadata == NULL || arrayRegion == NULL || config.pageCount == 0U
+        || !dzIsValidCellType(config.cellType))
+        return DZ_RESULT_INVALID_ARGUMENT;
 
-        pageMetadata->peCycles = pageMetadata->maxPeCycles;
-    }
+    dzPageBindArrays(metadata, arrayRegion, config);
 
     return DZ_RESULT_OK;
 }
 
-/* Returns the maximum P/E cycles of a page. */
-dzU32 dzPageGetMaxPeCycles(const dzByte *pagePtr, dzU32 pageSizeInBytes) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U) return 0U;
+/* Returns the maximum P/E cycles of the `pageIndex`-th page. */
+dzU32 dzPageGetMaxPeCycles(const dzPageMetadata *metadata, dzU64 pageIndex) {
+    if (!dzIsValidPageIndex(metadata, pageIndex)) return 0U;
+
+    return metadata->maxPeCycles[pageIndex];
+}
+
+/* 
+    Returns the maximum P/E cycles among `pageCount` pages 
+    starting from the `pageIndex`-th page.
+*/
+dzU32 dzPageGetMaxPeCyclesInRange(const dzPageMetadata *metadata,
+                                  dzU64 pageIndex,
+                                  dzU64 pageCount) {
+    if (!dzIsValidPageIndex(metadata, pageIndex)) return 0U;
+
+    if (pageCount > metadata->pageCount - pageIndex)
+        pageCount = metadata->pageCount - pageIndex;
+
+    const dzU32 *maxPeCycles = metadata->maxPeCycles + pageIndex;
 
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
+    dzU32 result = 0U;
 
-    return pageMetadata->maxPeCycles;
+    for (dzU64 i = 0U; i < pageCount; i++)
+        if (result < maxPeCycles[i]) result = maxPeCycles[i];
+
+    return result;
 }
 
 /* Returns the size of `dzPageMetadata`. */
@@ -164,52 +220,48 @@ dzUSize dzPageGetMetadataSize(void) {
     return sizeof(dzPageMetadata);
 }
 
-/* ========================================================================> */
-
-/* Returns the physical page address of a page. */
-dzPPA dzPageGetPPA(const dzByte *pagePtr, dzU32 pageSizeInBytes) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U)
-        return (dzPPA) { .chipId = DZ_CHIP_INVALID_ID,
-                         .dieId = DZ_DIE_INVALID_ID,
-                         .planeId = DZ_PLANE_INVALID_ID,
-                         .blockId = DZ_BLOCK_INVALID_ID,
-                         .pageId = DZ_PAGE_INVALID_ID };
-
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
+/* Returns the size of the per-page arrays for `pageCount` pages. */
+dzUSize dzPageGetArrayRegionSize(dzU64 pageCount) {
+    return pageCount * dzPageGetSpareSize();
+}
 
-    return pageMetadata->physicalPageAddress;
+/* Returns the number of metadata bytes stored for each page. */
+dzUSize dzPageGetSpareSize(void) {
+    return sizeof(dzU64)     // `programCounts`
+           + sizeof(dzU64)   // `readCounts`
+           + sizeof(dzU32)   // `peCycles`
+           + sizeof(dzU32)   // `maxPeCycles`
+           + sizeof(dzI8)    // `states`
+           + sizeof(dzByte); // `factoryMarkers`
 }
 
-/* Returns the current state of a page. */
-dzPageState dzPageGetState(const dzByte *pagePtr, dzU32 pageSizeInBytes) {
-    if (pagePtr == NULL) return DZ_PAGE_STATE_UNKNOWN;
+/* ========================================================================> */
 
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
+/* Returns the current state of the `pageIndex`-th page. */
+dzPageState dzPageGetState(const dzPageMetadata *metadata, dzU64 pageIndex) {
+    if (!dzIsValidPageIndex(metadata, pageIndex)) return DZ_PAGE_STATE_UNKNOWN;
 
-    return pageMetadata->state;
+    return (dzPageState) metadata->states[pageIndex];
 }
 
-/* Returns the read latency of a page, in milliseconds. */
-dzResult dzPageGetReadLatency(const dzByte *pagePtr,
-                              dzU32 pageSizeInBytes,
+/* Returns the read latency of the `pageIndex`-th page, in milliseconds. */
+dzResult dzPageGetReadLatency(dzPageMetadata *metadata,
+                              dzU64 pageIndex,
+                              dzRng *rng,
                               dzF64 *tR) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U || tR == NULL)
+    if (!dzIsValidPageIndex(metadata, pageIndex) || tR == NULL)
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
-
-    pageMetadata->totalReadCount++;
+    metadata->readCounts[pageIndex]++;
 
     {
         dzF64 rawLatency =
-            dzUtilsGaussian(readLatencyTable[pageMetadata->cellType],
-                            DZ_PAGE_READ_LATENCY_STDDEV_RATIO
-                                * readLatencyTable[pageMetadata->cellType]);
+            dzUtilsRngGaussian(rng,
+                               readLatencyTable[metadata->cellType],
+                               DZ_PAGE_READ_LATENCY_STDDEV_RATIO
+                                   * readLatencyTable[metadata->cellType]);
 
-        dzF64 maxLatency = pageMetadata->maxReadLatency;
+        dzF64 maxLatency = metadata->maxReadLatency;
 
         *tR = dzUtilsClampF64(rawLatency, 0.01, maxLatency);
     }
@@ -217,156 +269,141 @@ dzResult dzPageGetReadLatency(const dzByte *pagePtr,
     return DZ_RESULT_OK;
 }
 
-/* Returns the maximum program latency of a page, in milliseconds. */
-dzResult dzPageGetMaxProgramLatency(const dzByte *pagePtr,
-                                    dzU32 pageSizeInBytes,
+/* Returns the maximum program latency of all pages, in milliseconds. */
+dzResult dzPageGetMaxProgramLatency(const dzPageMetadata *metadata,
                                     dzF64 *tPROG) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U || tPROG == NULL)
-        return DZ_RESULT_INVALID_ARGUMENT;
-
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
+    if (metadata == NULL || tPROG == NULL) return DZ_RESULT_INVALID_ARGUMENT;
 
-    *tPROG = pageMetadata->maxProgramLatency;
+    *tPROG = metadata->maxProgramLatency;
 
     return DZ_RESULT_OK;
 }
 
-/* Returns the maximum read latency of a page, in milliseconds. */
-dzResult dzPageGetMaxReadLatency(const dzByte *pagePtr,
-                                 dzU32 pageSizeInBytes,
-                                 dzF64 *tR) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U || tR == NULL)
-        return DZ_RESULT_INVALID_ARGUMENT;
-
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
+/* Returns the maximum read latency of all pages, in milliseconds. */
+dzResult dzPageGetMaxReadLatency(const dzPageMetadata *metadata, dzF64 *tR) {
+    if (metadata == NULL || tR == NULL) return DZ_RESULT_INVALID_ARGUMENT;
 
-    *tR = pageMetadata->maxReadLatency;
+    *tR = metadata->maxReadLatency;
 
     return DZ_RESULT_OK;
 }
 
 /* ========================================================================> */
 
-/* Returns `true` if the given page is factory-bad. */
-dzBool dzPageIsFactoryBad(dzByte *pagePtr, dzU32 pageSizeInBytes) {
-    if (pagePtr != NULL && pageSizeInBytes != 0U) return false;
-
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
+/* Returns `true` if the `pageIndex`-th page is factory-bad. */
+dzBool dzPageIsFactoryBad(const dzPageMetadata *metadata, dzU64 pageIndex) {
+    if (!dzIsValidPageIndex(metadata, pageIndex)) return false;
 
-    return (pageMetadata->factoryMarker == 0U);
+    return (metadata->factoryMarkers[pageIndex] == 0x00U);
 }
 
-/* Marks a page as bad. */
-dzResult dzPageMarkAsBad(dzByte *pagePtr, dzU32 pageSizeInBytes) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U)
+/* Marks the `pageIndex`-th page as bad. */
+dzResult dzPageMarkAsBad(dzPageMetadata *metadata, dzU64 pageIndex) {
+    if (!dzIsValidPageIndex(metadata, pageIndex))
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
-
     // NOTE: Free blocks can never be corrupted
-    if (pageMetadata->state == DZ_PAGE_STATE_FREE)
+    if (metadata->states[pageIndex] == DZ_PAGE_STATE_FREE)
         return DZ_RESULT_INVALID_STATE;
 
-    pageMetadata->state = DZ_PAGE_STATE_BAD;
+    metadata->states[pageIndex] = DZ_PAGE_STATE_BAD;
 
     return DZ_RESULT_OK;
 }
 
-/* Marks a page as factory-bad. */
-dzResult dzPageMarkAsFactoryBad(dzByte *pagePtr, dzU32 pageSizeInBytes) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U)
+/* Marks the `pageIndex`-th page as factory-bad. */
+dzResult dzPageMarkAsFactoryBad(dzPageMetadata *metadata, dzU64 pageIndex) {
+    if (!dzIsValidPageIndex(metadata, pageIndex))
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
-
     /*
         NOTE: According to the ONFI 1.0 specification, 
               at least one byte has to be `0x00`
               in order to mark this page as defective
     */
-    pageMetadata->factoryMarker = 0U;
+    metadata->factoryMarkers[pageIndex] = 0x00U;
 
-    pageMetadata->state = DZ_PAGE_STATE_BAD;
+    metadata->states[pageIndex] = DZ_PAGE_STATE_BAD;
 
     return DZ_RESULT_OK;
 }
 
-/* Marks a page as free. */
-dzResult dzPageMarkAsFree(dzByte *pagePtr, dzU32 pageSizeInBytes) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U)
+/* Marks the `pageIndex`-th page as free. */
+dzResult dzPageMarkAsFree(dzPageMetadata *metadata, dzU64 pageIndex) {
+    if (!dzIsValidPageIndex(metadata, pageIndex))
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
+    dzI8 state = metadata->states[pageIndex];
 
-    if (pageMetadata->state == DZ_PAGE_STATE_BAD
-        || pageMetadata->state == DZ_PAGE_STATE_FREE
-        || pageMetadata->state == DZ_PAGE_STATE_RESERVED)
+    if (state == DZ_PAGE_STATE_BAD || state == DZ_PAGE_STATE_FREE
+        || state == DZ_PAGE_STATE_RESERVED)
         return DZ_RESULT_INVALID_STATE;
 
-    pageMetadata->peCycles--;
+    dzU32 peCycles = --(metadata->peCycles[pageIndex]);
 
-    pageMetadata->state = (pageMetadata->peCycles == 0U) ? DZ_PAGE_STATE_BAD
-                                                         : DZ_PAGE_STATE_FREE;
+    metadata->states[pageIndex] = (peCycles == 0U) ? DZ_PAGE_STATE_BAD
+                                                   : DZ_PAGE_STATE_FREE;
 
     return DZ_RESULT_OK;
 }
 
-/* Marks a page as reserved. */
-dzResult dzPageMarkAsReserved(dzByte *pagePtr, dzU32 pageSizeInBytes) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U)
+/* Marks the `pageIndex`-th page as invalid. */
+dzResult dzPageMarkAsInvalid(dzPageMetadata *metadata, dzU64 pageIndex) {
+    if (!dzIsValidPageIndex(metadata, pageIndex))
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
+    // NOTE: Only the valid pages can be invalidated
+    if (metadata->states[pageIndex] != DZ_PAGE_STATE_VALID)
+        return DZ_RESULT_INVALID_STATE;
 
-    pageMetadata->state = DZ_PAGE_STATE_RESERVED;
+    metadata->states[pageIndex] = DZ_PAGE_STATE_INVALID;
 
     return DZ_RESULT_OK;
 }
 
-/* Marks a page as unknown. */
-dzResult dzPageMarkAsUnknown(dzByte *pagePtr, dzU32 pageSizeInBytes) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U)
+/* Marks the `pageIndex`-th page as reserved. */
+dzResult dzPageMarkAsReserved(dzPageMetadata *metadata, dzU64 pageIndex) {
+    if (!dzIsValidPageIndex(metadata, pageIndex))
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
+    metadata->states[pageIndex] = DZ_PAGE_STATE_RESERVED;
+
+    return DZ_RESULT_OK;
+}
+
+/* Marks the `pageIndex`-th page as unknown. */
+dzResult dzPageMarkAsUnknown(dzPageMetadata *metadata, dzU64 pageIndex) {
+    if (!dzIsValidPageIndex(metadata, pageIndex))
+        return DZ_RESULT_INVALID_ARGUMENT;
 
-    pageMetadata->state = DZ_PAGE_STATE_UNKNOWN;
+    metadata->states[pageIndex] = DZ_PAGE_STATE_UNKNOWN;
 
     return DZ_RESULT_OK;
 }
 
-/* Marks a page as valid. */
-dzResult dzPageMarkAsValid(dzByte *pagePtr,
-                           dzU32 pageSizeInBytes,
+/* Marks the `pageIndex`-th page as valid. */
+dzResult dzPageMarkAsValid(dzPageMetadata *metadata,
+                           dzU64 pageIndex,
+                           dzRng *rng,
                            dzF64 *tPROG) {
-    if (pagePtr == NULL || pageSizeInBytes == 0U || tPROG == NULL)
+    if (!dzIsValidPageIndex(metadata, pageIndex) || tPROG == NULL)
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    dzPageMetadata *pageMetadata = (dzPageMetadata *) (pagePtr
-                                                       + pageSizeInBytes);
-
-    if (pageMetadata->state != DZ_PAGE_STATE_FREE)
+    if (metadata->states[pageIndex] != DZ_PAGE_STATE_FREE)
         return DZ_RESULT_INVALID_STATE;
 
-    pageMetadata->totalProgramCount++;
+    metadata->programCounts[pageIndex]++;
 
-    pageMetadata->state = DZ_PAGE_STATE_VALID;
+    metadata->states[pageIndex] = DZ_PAGE_STATE_VALID;
 
     {
         dzF64 rawLatency =
-            dzUtilsGaussian(programLatencyTable[pageMetadata->cellType],
-                            DZ_PAGE_PROGRAM_LATENCY_STDDEV_RATIO
-                                * programLatencyTable[pageMetadata->cellType]);
+            dzUtilsRngGaussian(rng,
+                               programLatencyTable[metadata->cellType],
+                               DZ_PAGE_PROGRAM_LATENCY_STDDEV_RATIO
+                                   * programLatencyTable[metadata->cellType]);
 
-        dzF64 maxLatency = pageMetadata->maxProgramLatency;
+        dzF64 maxLatency = metadata->maxProgramLatency;
 
         *tPROG = dzUtilsClampF64(rawLatency, 0.01, maxLatency);
     }
@@ -376,7 +413,70 @@ dzResult dzPageMarkAsValid(dzByte *pagePtr,
 
 /* Private Functions ======================================================> */
 
+/* Places the per-page arrays of `metadata` in `arrayRegion`. */
+static void dzPageBindArrays(dzPageMetadata *metadata,
+                             dzByte *arrayRegion,
+                             dzPageConfig config) {
+    {
+        dzU64 pageCount = config.pageCount;
+
+        // NOTE: Arrays are laid out in the order of decreasing alignment
+        metadata->programCounts = (dzU64 *) arrayRegion;
+        metadata->readCounts = metadata->programCounts + pageCount;
+        metadata->peCycles = (dzU32 *) (metadata->readCounts + pageCount);
+        metadata->maxPeCycles = metadata->peCycles + pageCount;
+        metadata->states = (dzI8 *) (metadata->maxPeCycles + pageCount);
+        metadata->factoryMarkers = (dzByte *) (metadata->states + pageCount);
+
+        metadata->pageCount = pageCount;
+        metadata->cellType = config.cellType;
+    }
+
+    {
+        dzF64 programLatencyMu = programLatencyTable[metadata->cellType];
+        dzF64 programLatencySigma = DZ_PAGE_PROGRAM_LATENCY_STDDEV_RATIO
+                                    * programLatencyMu;
+
+        metadata->maxProgramLatency = programLatencyMu
+                                      + (3.0 * programLatencySigma);
+
+        dzF64 readLatencyMu = readLatencyTable[metadata->cellType];
+        dzF64 readLatencySigma = DZ_PAGE_READ_LATENCY_STDDEV_RATIO
+                                 * readLatencyMu;
+
+        metadata->maxReadLatency = readLatencyMu + (3.0 * readLatencySigma);
+    }
+}
+
+/* Returns the endurance penalty of the `pageIndex`-th page. */
+DZ_API_STATIC_INLINE dzF64 dzPageGetEndurancePenalty(dzU64 pageIndex,
+                                                     dzU64 pageCount) {
+    dzF64 result = 1.0;
+
+    // NOTE: Pages in the top and bottom layers should have lower endurance
+    if (pageCount >= 2U) {
+        dzU64 centerPageIndex = pageCount >> 1U;
+
+        dzU64 distanceFromCenter = (pageIndex > centerPageIndex)
+                                       ? (pageIndex - centerPageIndex)
+                                       : (centerPageIndex - pageIndex);
+
+        dzF64 penaltyScale = ((dzF64) distanceFromCenter
+                              / (dzF64) centerPageIndex);
+
+        result -= (penaltyScale * DZ_PAGE_PE_CYCLES_MAX_PENALTY);
+    }
+
+    return (result > 0.0) ? result : 0.0;
+}
+
 /* Returns `true` if `cellType` is a valid NAND flash cell type. */
 DZ_API_STATIC_INLINE bool dzIsValidCellType(dzCellType cellType) {
     return (cellType > DZ_CELL_TYPE_UNKNOWN && cellType < DZ_CELL_TYPE_COUNT_);
 }
+
+/* Returns `true` if `pageIndex` is a valid page index within `metadata`. */
+DZ_API_STATIC_INLINE bool dzIsValidPageIndex(const dzPageMetadata *metadata,
+                                             dzU64 pageIndex) {
+    return (metadata != NULL && pageIndex < metadata->pageCount);
+}
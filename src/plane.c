@@ -32,7 +32,9 @@
 
 /* A structure that represents the metadata of a NAND flash plane. */
 struct dzPlaneMetadata_ {
-    dzByte *blockStateMap;
+    dzU64 *blockStateMaps;
+    dzU64 validPageCount;
+    dzU64 invalidPageCount;
     dzU64 leastEraseCount;
     dzU64 leastWornBlockId;
     dzU64 blockCount;
@@ -51,25 +53,38 @@ const dzU64 DZ_PLANE_INVALID_ID = UINT64_MAX;
 
 /* Private Function Prototypes ============================================> */
 
-// TODO: ...
+/* Returns the pointer to the block state bitmap of `blockState`. */
+DZ_API_STATIC_INLINE dzU64 *dzPlaneGetBlockStateMap(
+    const dzPlaneMetadata *metadata,
+    dzBlockState blockState);
+
+/* Returns `true` if `blockState` has its own block state bitmap. */
+DZ_API_STATIC_INLINE dzBool dzPlaneIsValidBlockState(dzBlockState blockState);
+
+/* Returns the pointer to the page counter of `pageState`, if any. */
+DZ_API_STATIC_INLINE dzU64 *dzPlaneGetPageCounter(dzPlaneMetadata *metadata,
+                                                  dzPageState pageState);
 
 /* Public Functions =======================================================> */
 
-/* Initializes a plane metadata within the given `metadata` region. */
-dzResult dzPlaneInitMetadata(dzPlaneMetadata *metadata, dzPlaneConfig config) {
-    if (metadata == NULL || config.blockCount == 0U
+/* 
+    Initializes a plane metadata within the given `metadata` region, 
+    placing its block state maps in `mapRegion`.
+*/
+dzResult dzPlaneInitMetadata(dzPlaneMetadata *metadata,
+                             dzByte *mapRegion,
+                             dzPlaneConfig config) {
+    if (metadata == NULL || mapRegion == NULL || config.blockCount == 0U
         || config.planeId == DZ_PLANE_INVALID_ID)
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    {
-        metadata->blockStateMap = malloc(config.blockCount
-                                         * sizeof *(metadata->blockStateMap));
-
-        for (dzU64 i = 0U; i < config.blockCount; i++)
-            metadata->blockStateMap[i] = DZ_BLOCK_STATE_FREE;
-    }
+    // NOTE: One bitmap for each block state, packed into 64-bit words
+    metadata->blockStateMaps = (dzU64 *) mapRegion;
 
     {
+        metadata->validPageCount = 0U;
+        metadata->invalidPageCount = 0U;
+
         metadata->leastEraseCount = UINT64_MAX;
         metadata->leastWornBlockId = config.blockCount - 1U;
 
@@ -79,14 +94,21 @@ dzResult dzPlaneInitMetadata(dzPlaneMetadata *metadata, dzPlaneConfig config) {
         // TODO: ...
     }
 
+    for (dzI32 i = DZ_BLOCK_STATE_FREE; i < DZ_BLOCK_STATE_COUNT_; i++)
+        dzUtilsBitmapFill(dzPlaneGetBlockStateMap(metadata, i),
+                          metadata->blockCount,
+                          (i == DZ_BLOCK_STATE_FREE));
+
     return DZ_RESULT_OK;
 }
 
-/* De-initializes the plane `metadata`. */
-void dzPlaneDeinitMetadata(dzPlaneMetadata *metadata) {
-    if (metadata == NULL) return;
-
-    free(metadata->blockStateMap);
+/* 
+    Returns the size of the block state maps 
+    of a plane with `blockCount` blocks.
+*/
+dzUSize dzPlaneGetMapRegionSize(dzU64 blockCount) {
+    return DZ_BLOCK_STATE_COUNT_ * dzUtilsBitmapGetWordCount(blockCount)
+           * sizeof(dzU64);
 }
 
 /* Returns the size of `dzPlaneMetadata`. */
@@ -96,22 +118,102 @@ dzUSize dzPlaneGetMetadataSize(void) {
 
 /* ========================================================================> */
 
+/* 
+    Returns the identifier of the first block in `blockState` 
+    at or after `blockId` within a plane.
+*/
+dzU64 dzPlaneFindNextBlockId(const dzPlaneMetadata *metadata,
+                             dzBlockState blockState,
+                             dzU64 blockId) {
+    if (metadata == NULL || !dzPlaneIsValidBlockState(blockState))
+        return DZ_BLOCK_INVALID_ID;
+
+    dzU64 result =
+        dzUtilsBitmapFindNext(dzPlaneGetBlockStateMap(metadata, blockState),
+                              metadata->blockCount,
+                              blockId);
+
+    return (result != UINT64_MAX) ? result : DZ_BLOCK_INVALID_ID;
+}
+
+/* Returns the number of blocks in `blockState` within a plane. */
+dzU64 dzPlaneGetBlockCountByState(const dzPlaneMetadata *metadata,
+                                  dzBlockState blockState) {
+    if (metadata == NULL || !dzPlaneIsValidBlockState(blockState)) return 0U;
+
+    return dzUtilsBitmapCount(dzPlaneGetBlockStateMap(metadata, blockState),
+                              metadata->blockCount);
+}
+
+/* Returns the state of the `blockId`-th block within a plane. */
+dzBlockState dzPlaneGetBlockState(const dzPlaneMetadata *metadata,
+                                  dzU64 blockId) {
+    if (metadata == NULL || blockId >= metadata->blockCount)
+        return DZ_BLOCK_STATE_UNKNOWN;
+
+    for (dzI32 i = DZ_BLOCK_STATE_FREE; i < DZ_BLOCK_STATE_COUNT_; i++)
+        if (dzUtilsBitmapTest(dzPlaneGetBlockStateMap(metadata, i), blockId))
+            return (dzBlockState) i;
+
+    return DZ_BLOCK_STATE_UNKNOWN;
+}
+
+/* Returns the number of invalid pages within a plane. */
+dzU64 dzPlaneGetInvalidPageCount(const dzPlaneMetadata *metadata) {
+    return (metadata != NULL) ? metadata->invalidPageCount : 0U;
+}
+
 /* Returns the identifier of the least worn block within a plane. */
 dzU64 dzPlaneGetLeastWornBlockId(const dzPlaneMetadata *metadata) {
     return (metadata != NULL) ? metadata->leastWornBlockId
                               : DZ_BLOCK_INVALID_ID;
 }
 
+/* Returns the number of valid pages within a plane. */
+dzU64 dzPlaneGetValidPageCount(const dzPlaneMetadata *metadata) {
+    return (metadata != NULL) ? metadata->validPageCount : 0U;
+}
+
 /* Updates the state of the given block within a plane's block state map. */
 dzResult dzPlaneUpdateBlockStateMap(dzPlaneMetadata *metadata,
                                     dzPBA pba,
                                     dzBlockState blockState) {
-    if (metadata == NULL || metadata->blockStateMap == NULL
+    if (metadata == NULL || metadata->blockStateMaps == NULL
         || pba.planeId != metadata->planeId
-        || pba.blockId == DZ_BLOCK_INVALID_ID)
+        || pba.blockId >= metadata->blockCount
+        || blockState < DZ_BLOCK_STATE_UNKNOWN
+        || blockState >= DZ_BLOCK_STATE_COUNT_)
         return DZ_RESULT_INVALID_ARGUMENT;
 
-    metadata->blockStateMap[pba.blockId] = (dzByte) blockState;
+    for (dzI32 i = DZ_BLOCK_STATE_FREE; i < DZ_BLOCK_STATE_COUNT_; i++)
+        dzUtilsBitmapClear(dzPlaneGetBlockStateMap(metadata, i), pba.blockId);
+
+    if (blockState != DZ_BLOCK_STATE_UNKNOWN)
+        dzUtilsBitmapSet(dzPlaneGetBlockStateMap(metadata, blockState),
+                         pba.blockId);
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Moves `pageCount` pages from `oldState` to `newState` 
+    within a plane's page counters.
+*/
+dzResult dzPlaneUpdatePageCounts(dzPlaneMetadata *metadata,
+                                 dzPageState oldState,
+                                 dzPageState newState,
+                                 dzU64 pageCount) {
+    if (metadata == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzU64 *oldPageCount = dzPlaneGetPageCounter(metadata, oldState);
+    dzU64 *newPageCount = dzPlaneGetPageCounter(metadata, newState);
+
+    if (oldPageCount != NULL && *oldPageCount < pageCount)
+        return DZ_RESULT_INVALID_STATE;
+
+    // NOTE: Only the valid and invalid pages are counted per plane
+    if (oldPageCount != NULL) *oldPageCount -= pageCount;
+    if (newPageCount != NULL) *newPageCount += pageCount;
 
     return DZ_RESULT_OK;
 }
@@ -130,4 +232,110 @@ dzResult dzPlaneUpdateLeastWornBlock(dzPlaneMetadata *metadata,
     }
 
     return DZ_RESULT_OK;
-}
\ No newline at end of file
+}
+
+/* ========================================================================> */
+
+/* Returns the size of the state of a plane with `blockCount` blocks. */
+dzUSize dzPlaneGetStateSize(dzU64 blockCount) {
+    return sizeof(dzU64)                           // `validPageCount`
+           + sizeof(dzU64)                         // `invalidPageCount`
+           + sizeof(dzU64)                         // `leastEraseCount`
+           + sizeof(dzU64)                         // `leastWornBlockId`
+           + dzPlaneGetMapRegionSize(blockCount);  // `blockStateMaps`
+}
+
+/* Reads the state of a plane from `src`. */
+dzResult dzPlaneReadState(dzPlaneMetadata *metadata, dzByteStream *src) {
+    if (metadata == NULL || src == NULL || src->ptr == NULL
+        || src->offset + dzPlaneGetStateSize(metadata->blockCount)
+               > src->size)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    (void) dzUtilsReadStream(src,
+                             &(metadata->validPageCount),
+                             sizeof metadata->validPageCount);
+
+    (void) dzUtilsReadStream(src,
+                             &(metadata->invalidPageCount),
+                             sizeof metadata->invalidPageCount);
+
+    (void) dzUtilsReadStream(src,
+                             &(metadata->leastEraseCount),
+                             sizeof metadata->leastEraseCount);
+
+    (void) dzUtilsReadStream(src,
+                             &(metadata->leastWornBlockId),
+                             sizeof metadata->leastWornBlockId);
+
+    (void) dzUtilsReadStream(src,
+                             metadata->blockStateMaps,
+                             dzPlaneGetMapRegionSize(metadata->blockCount));
+
+    return (metadata->leastWornBlockId < metadata->blockCount)
+               ? DZ_RESULT_OK
+               : DZ_RESULT_INVALID_METADATA;
+}
+
+/* Writes the state of a plane to `dst`. */
+dzResult dzPlaneWriteState(const dzPlaneMetadata *metadata,
+                           dzByteStream *dst) {
+    if (metadata == NULL || dst == NULL || dst->ptr == NULL
+        || dst->offset + dzPlaneGetStateSize(metadata->blockCount)
+               > dst->size)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    (void) dzUtilsWriteStream(dst,
+                              &(metadata->validPageCount),
+                              sizeof metadata->validPageCount);
+
+    (void) dzUtilsWriteStream(dst,
+                              &(metadata->invalidPageCount),
+                              sizeof metadata->invalidPageCount);
+
+    (void) dzUtilsWriteStream(dst,
+                              &(metadata->leastEraseCount),
+                              sizeof metadata->leastEraseCount);
+
+    (void) dzUtilsWriteStream(dst,
+                              &(metadata->leastWornBlockId),
+                              sizeof metadata->leastWornBlockId);
+
+    (void) dzUtilsWriteStream(dst,
+                              metadata->blockStateMaps,
+                              dzPlaneGetMapRegionSize(metadata->blockCount));
+
+    return DZ_RESULT_OK;
+}
+
+/* Private Functions ======================================================> */
+
+/* Returns the pointer to the block state bitmap of `blockState`. */
+DZ_API_STATIC_INLINE dzU64 *dzPlaneGetBlockStateMap(
+    const dzPlaneMetadata *metadata,
+    dzBlockState blockState) {
+    return metadata->blockStateMaps
+           + ((dzU64) blockState
+              * dzUtilsBitmapGetWordCount(metadata->blockCount));
+}
+
+/* Returns `true` if `blockState` has its own block state bitmap. */
+DZ_API_STATIC_INLINE dzBool dzPlaneIsValidBlockState(dzBlockState blockState) {
+    return (blockState > DZ_BLOCK_STATE_UNKNOWN
+            && blockState < DZ_BLOCK_STATE_COUNT_);
+}
+
+/* Returns the pointer to the page counter of `pageState`, if any. */
+DZ_API_STATIC_INLINE dzU64 *dzPlaneGetPageCounter(dzPlaneMetadata *metadata,
+                                                  dzPageState pageState) {
+    switch (pageState) {
+        case DZ_PAGE_STATE_VALID:
+            return &(metadata->validPageCount);
+
+        case DZ_PAGE_STATE_INVALID:
+            return &(metadata->invalidPageCount);
+
+        default:
+            return NULL;
+    }
+}
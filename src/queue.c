@@ -0,0 +1,304 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// clang-format off
+
+#define DZ_QUEUE_CACHE_LINE_SIZE  64U
+
+// clang-format on
+
+/* Typedefs ===============================================================> */
+
+/* 
+    A structure that represents a lock-free, single-producer and 
+    single-consumer ring of operations, whose indices never wrap around.
+*/
+typedef struct dzQueueRing_ {
+    dzSimOp **entries;
+    dzU64 mask;
+    dzByte padding0[DZ_QUEUE_CACHE_LINE_SIZE
+                    - (sizeof(dzSimOp **) + sizeof(dzU64))];
+    dzU64 head;        // Written by the consumer
+    dzU64 cachedTail;  // Consumer only
+    dzByte padding1[DZ_QUEUE_CACHE_LINE_SIZE - (2U * sizeof(dzU64))];
+    dzU64 tail;        // Written by the producer
+    dzU64 shadowTail;  // Producer only
+    dzU64 cachedHead;  // Producer only
+    dzByte padding2[DZ_QUEUE_CACHE_LINE_SIZE - (3U * sizeof(dzU64))];
+} dzQueueRing;
+
+/* 
+    A structure that represents a pair of lock-free submission and 
+    completion queues, shared by a host thread and a simulator thread.
+*/
+struct dzQueue_ {
+    dzQueueRing submissionRing;
+    dzQueueRing completionRing;
+    dzQueueConfig config;
+};
+
+/* Constants ==============================================================> */
+
+// TODO: ...
+
+/* Private Variables ======================================================> */
+
+// TODO: ...
+
+/* Private Function Prototypes ============================================> */
+
+/* Called when `op` in `queue` (the context of `op`) is completed. */
+static void dzQueueCompleteOp(dzSim *sim, dzSimOp *op);
+
+/* Initializes `ring` with `depth` entries. */
+static dzResult dzQueueInitRing(dzQueueRing *ring, dzU32 depth);
+
+/* Returns the number of entries that can still be written to `ring`. */
+DZ_API_STATIC_INLINE dzU64 dzQueueGetFreeCount(dzQueueRing *ring);
+
+/* Returns the number of entries that can be read from `ring`. */
+DZ_API_STATIC_INLINE dzU64 dzQueueGetReadyCount(dzQueueRing *ring);
+
+/* Public Functions =======================================================> */
+
+/* Initializes `*queue` with the given `config`. */
+dzResult dzQueueInit(dzQueue **queue, dzQueueConfig config) {
+    if (queue == NULL || config.depth == 0U
+        || (config.depth & (config.depth - 1U)) != 0U)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    void *ptr = NULL;
+
+    // NOTE: Keeps the indices of each side on their own cache lines
+    if (posix_memalign(&ptr, DZ_QUEUE_CACHE_LINE_SIZE, sizeof(dzQueue)) != 0)
+        return DZ_RESULT_NO_MEMORY;
+
+    dzQueue *newQueue = ptr;
+
+    newQueue->config = config;
+
+    dzResult submissionResult = dzQueueInitRing(&(newQueue->submissionRing),
+                                                config.depth);
+    dzResult completionResult = dzQueueInitRing(&(newQueue->completionRing),
+                                                config.depth);
+
+    if (submissionResult != DZ_RESULT_OK || completionResult != DZ_RESULT_OK) {
+        free(newQueue->submissionRing.entries);
+        free(newQueue->completionRing.entries);
+
+        free(newQueue);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    *queue = newQueue;
+
+    return DZ_RESULT_OK;
+}
+
+/* Releases the memory allocated for `queue`. */
+void dzQueueDeinit(dzQueue *queue) {
+    if (queue == NULL) return;
+
+    free(queue->submissionRing.entries);
+    free(queue->completionRing.entries);
+
+    free(queue);
+}
+
+/* ========================================================================> */
+
+/* Returns the number of entries in each queue of `queue`. */
+dzU32 dzQueueGetDepth(const dzQueue *queue) {
+    return (queue != NULL) ? queue->config.depth : 0U;
+}
+
+/* ========================================================================> */
+
+/* 
+    Places `op` in the submission queue of `queue`, without making it 
+    visible to the simulator until the next doorbell (host thread only).
+*/
+dzResult dzQueueSubmit(dzQueue *queue, dzSimOp *op) {
+    if (queue == NULL || op == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzQueueRing *ring = &(queue->submissionRing);
+
+    if (dzQueueGetFreeCount(ring) == 0U) return DZ_RESULT_BUSY;
+
+    ring->entries[ring->shadowTail & ring->mask] = op;
+
+    ring->shadowTail++;
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Makes all operations placed in the submission queue of `queue` 
+    since the last doorbell visible to the simulator (host thread only).
+*/
+void dzQueueRingDoorbell(dzQueue *queue) {
+    if (queue == NULL) return;
+
+    dzQueueRing *ring = &(queue->submissionRing);
+
+    __atomic_store_n(&(ring->tail), ring->shadowTail, __ATOMIC_RELEASE);
+}
+
+/* 
+    Removes up to `count` completed operations from the completion queue 
+    of `queue`, stores them in `ops`, and returns the number of 
+    removed operations (host thread only).
+*/
+dzU64 dzQueuePollCompletions(dzQueue *queue, dzSimOp **ops, dzU64 count) {
+    if (queue == NULL || ops == NULL) return 0U;
+
+    dzQueueRing *ring = &(queue->completionRing);
+
+    dzU64 readyCount = dzQueueGetReadyCount(ring);
+
+    if (count > readyCount) count = readyCount;
+
+    for (dzU64 i = 0U; i < count; i++)
+        ops[i] = ring->entries[(ring->head + i) & ring->mask];
+
+    // NOTE: Frees all removed entries at once
+    __atomic_store_n(&(ring->head), ring->head + count, __ATOMIC_RELEASE);
+
+    return count;
+}
+
+/* 
+    Submits all visible operations in the submission queue of `queue` 
+    to `sim`, routed through `ssd` unless it is `NULL`, and returns 
+    the number of submitted operations (simulator thread only).
+*/
+dzU64 dzQueueProcess(dzQueue *queue, dzSSD *ssd, dzSim *sim) {
+    if (queue == NULL || sim == NULL) return 0U;
+
+    dzQueueRing *submissionRing = &(queue->submissionRing);
+    dzQueueRing *completionRing = &(queue->completionRing);
+
+    dzU64 count = dzQueueGetReadyCount(submissionRing);
+
+    {
+        dzU64 completionHead = __atomic_load_n(&(completionRing->head),
+                                               __ATOMIC_ACQUIRE);
+
+        /*
+            NOTE: Every submitted operation takes up a completion entry 
+                  until the host removes it, so that the completion 
+                  queue can never overflow
+        */
+
+        dzU64 outstandingCount = submissionRing->head - completionHead;
+
+        if (count > queue->config.depth - outstandingCount)
+            count = queue->config.depth - outstandingCount;
+    }
+
+    for (dzU64 i = 0U; i < count; i++) {
+        dzSimOp *op = submissionRing->entries[(submissionRing->head + i)
+                                              & submissionRing->mask];
+
+        /*
+            NOTE: The completion of `op` is reported through the 
+                  completion queue, so any callback set by the host 
+                  would be overwritten here
+        */
+        op->onComplete = dzQueueCompleteOp, op->ctx = queue;
+
+        dzResult result = (ssd != NULL) ? dzSSDSubmitOp(ssd, sim, op, 0U)
+                                        : dzSimSubmitOp(sim, op, 0U);
+
+        // NOTE: Rejected operations are completed with an error
+        if (result != DZ_RESULT_OK) {
+            op->result = result;
+
+            op->issueTime = op->startTime = op->endTime =
+                dzSimGetCurrentTime(sim);
+
+            dzQueueCompleteOp(sim, op);
+        }
+    }
+
+    // NOTE: Frees all consumed entries at once
+    __atomic_store_n(&(submissionRing->head),
+                     submissionRing->head + count,
+                     __ATOMIC_RELEASE);
+
+    return count;
+}
+
+/* Private Functions ======================================================> */
+
+/* Called when `op` in `queue` (the context of `op`) is completed. */
+static void dzQueueCompleteOp(dzSim *sim, dzSimOp *op) {
+    DZ_API_UNUSED_VARIABLE(sim);
+
+    dzQueueRing *ring = &(((dzQueue *) op->ctx)->completionRing);
+
+    ring->entries[ring->shadowTail & ring->mask] = op;
+
+    ring->shadowTail++;
+
+    __atomic_store_n(&(ring->tail), ring->shadowTail, __ATOMIC_RELEASE);
+}
+
+/* Initializes `ring` with `depth` entries. */
+static dzResult dzQueueInitRing(dzQueueRing *ring, dzU32 depth) {
+    ring->entries = malloc(depth * sizeof *(ring->entries));
+
+    ring->mask = depth - 1U;
+
+    ring->head = ring->cachedTail = 0U;
+
+    ring->tail = ring->shadowTail = ring->cachedHead = 0U;
+
+    return (ring->entries != NULL) ? DZ_RESULT_OK : DZ_RESULT_NO_MEMORY;
+}
+
+/* Returns the number of entries that can still be written to `ring`. */
+DZ_API_STATIC_INLINE dzU64 dzQueueGetFreeCount(dzQueueRing *ring) {
+    dzU64 depth = ring->mask + 1U;
+
+    // NOTE: Only touches the index of the consumer when it seems full
+    if (ring->shadowTail - ring->cachedHead == depth)
+        ring->cachedHead = __atomic_load_n(&(ring->head), __ATOMIC_ACQUIRE);
+
+    return depth - (ring->shadowTail - ring->cachedHead);
+}
+
+/* Returns the number of entries that can be read from `ring`. */
+DZ_API_STATIC_INLINE dzU64 dzQueueGetReadyCount(dzQueueRing *ring) {
+    // NOTE: Only touches the index of the producer when it seems empty
+    if (ring->cachedTail == ring->head)
+        ring->cachedTail = __atomic_load_n(&(ring->tail), __ATOMIC_ACQUIRE);
+
+    return ring->cachedTail - ring->head;
+}
@@ -0,0 +1,932 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// clang-format off
+
+#define DZ_SIM_DEFAULT_EVENT_CAPACITY  1024U
+#define DZ_SIM_EVENT_QUEUE_ARITY       4U
+#define DZ_SIM_INVALID_EVENT_INDEX     UINT64_MAX
+
+// clang-format on
+
+/* Typedefs ===============================================================> */
+
+/* A structure that represents an event in the event queue. */
+typedef struct dzSimEvent_ {
+    dzU64 time;
+    dzU64 sequence;
+    dzSimEventCallback callback;
+    void *ctx;
+} dzSimEvent;
+
+/* 
+    A structure that represents a discrete-event simulator, 
+    with its event queue stored as an implicit 4-ary min-heap.
+*/
+struct dzSim_ {
+    dzSimConfig config;
+    dzSimEvent *events;
+    dzU64 eventCapacity;
+    dzU64 currentTime;
+    dzU64 nextSequence;
+    dzU64 pendingEventCount;
+    dzU64 processedEventCount;
+};
+
+/* A structure that represents the shared state of a parallel run. */
+typedef struct dzSimParallelContext_ {
+    dzSim **sims;
+    dzU32 simCount;
+    dzU32 nextSimIndex;
+    dzU32 activeThreadCount;
+    dzBool isDone;
+    dzU64 windowEndTime;
+    dzU64 generation;
+    pthread_mutex_t mutex;
+    pthread_cond_t startCond;
+    pthread_cond_t doneCond;
+} dzSimParallelContext;
+
+/* Private Function Prototypes ============================================> */
+
+/* Called when `ctx` (a `dzSimOp`) is completed. */
+static void dzSimCompleteOp(dzSim *sim, void *ctx);
+
+/* Called when `ctx` (a `dzSimOp`) is started. */
+static void dzSimStartOp(dzSim *sim, void *ctx);
+
+/* 
+    Returns the index of the event that completes the operation 
+    that `op` (a read) can suspend, or `DZ_SIM_INVALID_EVENT_INDEX` 
+    if there is none, in which case `*readyTime` may be moved earlier.
+*/
+static dzU64 dzSimFindSuspendableOp(const dzSim *sim,
+                                    const dzSimOp *op,
+                                    dzU64 *readyTime);
+
+/* 
+    Stores the time of the earliest event in the `simCount` simulators 
+    in `sims` into `time`, and returns `false` if there are no events left.
+*/
+DZ_API_STATIC_INLINE dzBool dzSimGetNextEventTime(dzSim **sims,
+                                                  dzU32 simCount,
+                                                  dzU64 *time);
+
+/* Returns the mask of all planes accessed by `op`. */
+DZ_API_STATIC_INLINE dzU64 dzSimGetOpPlaneMask(const dzSimOp *op);
+
+/* Returns the earliest time at which the die can accept `op`. */
+DZ_API_STATIC_INLINE dzU64 dzSimGetOpReadyTime(const dzSimOp *op);
+
+/* Returns `true` if `e1` must be processed before `e2`. */
+DZ_API_STATIC_INLINE dzBool dzSimIsEarlierEvent(const dzSimEvent *e1,
+                                                const dzSimEvent *e2);
+
+/* Stores `event` in the `index`-th slot of the event queue of `sim`. */
+DZ_API_STATIC_INLINE void dzSimPlaceEvent(dzSim *sim,
+                                          dzU64 index,
+                                          const dzSimEvent *event);
+
+/* Runs `op` on its die as a multi-plane operation. */
+static dzResult dzSimRunMultiPlaneOp(dzSimOp *op);
+
+/* Runs `op` on its die as a single-plane operation. */
+static dzResult dzSimRunSinglePlaneOp(dzSimOp *op);
+
+/* 
+    Reserves the bus of the channel of `op` for `duration` nanoseconds, 
+    no earlier than `time`, and returns the time at which it is granted.
+*/
+static dzU64 dzSimReserveBus(const dzSimOp *op, dzU64 time, dzU64 duration);
+
+/* 
+    Reserves the array and the cache register of the die for `op`, 
+    which has just been run, and returns the time at which it completes.
+*/
+static dzU64 dzSimReserveOp(dzSimOp *op);
+
+/* 
+    Suspends the operation completed by the `eventIndex`-th event 
+    in `sim` for `op` (a read), which has just been run, 
+    and returns the time at which `op` completes.
+*/
+static dzU64 dzSimSuspendOp(dzSim *sim, dzSimOp *op, dzU64 eventIndex);
+
+/* Removes the earliest event in `sim`, and stores it in `event`. */
+static void dzSimPopEvent(dzSim *sim, dzSimEvent *event);
+
+/* 
+    Moves `event` down from the `index`-th slot of the event queue 
+    of `sim`, until the heap property is restored.
+*/
+static void dzSimSiftDown(dzSim *sim, dzU64 index, dzSimEvent event);
+
+/* Inserts `event` into the event queue of `sim`. */
+static dzResult dzSimPushEvent(dzSim *sim, dzSimEvent event);
+
+/* 
+    Runs the remaining simulators in `ctx` until the end of 
+    the current window.
+*/
+static void dzSimRunWindow(dzSimParallelContext *ctx);
+
+/* Runs the windows of the parallel run in `ctx`, until it is done. */
+static void *dzSimRunWindowWorker(void *ctx);
+
+/* Returns the given `latency` in milliseconds, in nanoseconds. */
+DZ_API_STATIC_INLINE dzU64 dzSimToNanoseconds(dzF64 latency);
+
+/* Public Functions =======================================================> */
+
+/* Initializes `*sim` with the given `config`. */
+dzResult dzSimInit(dzSim **sim, dzSimConfig config) {
+    if (sim == NULL || config.eventCapacity > (SIZE_MAX / sizeof(dzSimEvent)))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    if (config.eventCapacity == 0U)
+        config.eventCapacity = DZ_SIM_DEFAULT_EVENT_CAPACITY;
+
+    dzSim *newSim = malloc(sizeof *newSim);
+
+    if (newSim == NULL) return DZ_RESULT_NO_MEMORY;
+
+    {
+        newSim->events = malloc(config.eventCapacity
+                                * sizeof *(newSim->events));
+
+        newSim->config = config;
+
+        newSim->eventCapacity = config.eventCapacity;
+
+        newSim->currentTime = newSim->nextSequence = 0U;
+
+        newSim->pendingEventCount = newSim->processedEventCount = 0U;
+    }
+
+    if (newSim->events == NULL) {
+        free(newSim);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    *sim = newSim;
+
+    return DZ_RESULT_OK;
+}
+
+/* Releases the memory allocated for `sim`. */
+void dzSimDeinit(dzSim *sim) {
+    if (sim == NULL) return;
+
+    free(sim->events), free(sim);
+}
+
+/* ========================================================================> */
+
+/* Returns the current time of `sim`, in nanoseconds. */
+dzU64 dzSimGetCurrentTime(const dzSim *sim) {
+    return (sim != NULL) ? sim->currentTime : 0U;
+}
+
+/* Returns the number of events in `sim` that have not been processed yet. */
+dzU64 dzSimGetPendingEventCount(const dzSim *sim) {
+    return (sim != NULL) ? sim->pendingEventCount : 0U;
+}
+
+/* Returns the total number of events processed by `sim`. */
+dzU64 dzSimGetProcessedEventCount(const dzSim *sim) {
+    return (sim != NULL) ? sim->processedEventCount : 0U;
+}
+
+/* ========================================================================> */
+
+/* 
+    Processes all events in `sim` scheduled at or before `endTime`, 
+    and returns the number of processed events.
+*/
+dzU64 dzSimRun(dzSim *sim, dzU64 endTime) {
+    if (sim == NULL) return 0U;
+
+    dzU64 oldProcessedEventCount = sim->processedEventCount;
+
+    while (sim->pendingEventCount > 0U && sim->events[0].time <= endTime)
+        (void) dzSimStep(sim);
+
+    return sim->processedEventCount - oldProcessedEventCount;
+}
+
+/* 
+    Processes all events in the `simCount` simulators in `sims` 
+    scheduled at or before `endTime` in parallel, and returns 
+    the number of processed events.
+*/
+dzU64 dzSimRunParallel(dzSim **sims,
+                       dzU32 simCount,
+                       dzU64 endTime,
+                       dzSimParallelConfig config) {
+    if (sims == NULL || simCount == 0U || config.lookahead == 0U) return 0U;
+
+    for (dzU32 i = 0U; i < simCount; i++)
+        if (sims[i] == NULL) return 0U;
+
+    dzU32 threadCount = config.threadCount;
+
+    if (threadCount == 0U) {
+        long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+        threadCount = (processorCount > 0) ? (dzU32) processorCount : 1U;
+    }
+
+    if (threadCount > simCount) threadCount = simCount;
+
+    dzSimParallelContext ctx = { .sims = sims,
+                                 .simCount = simCount,
+                                 .nextSimIndex = 0U,
+                                 .activeThreadCount = 0U,
+                                 .isDone = false,
+                                 .windowEndTime = 0U,
+                                 .generation = 0U };
+
+    (void) pthread_mutex_init(&(ctx.mutex), NULL);
+
+    (void) pthread_cond_init(&(ctx.startCond), NULL);
+    (void) pthread_cond_init(&(ctx.doneCond), NULL);
+
+    pthread_t *threads = NULL;
+
+    dzU32 spawnedThreadCount = 0U;
+
+    if (threadCount > 1U)
+        threads = malloc((threadCount - 1U) * sizeof *threads);
+
+    for (; threads != NULL && spawnedThreadCount < threadCount - 1U;
+         spawnedThreadCount++)
+        if (pthread_create(&threads[spawnedThreadCount],
+                           NULL,
+                           dzSimRunWindowWorker,
+                           &ctx)
+            != 0)
+            break;
+
+    dzU64 oldProcessedEventCount = 0U;
+
+    for (dzU32 i = 0U; i < simCount; i++)
+        oldProcessedEventCount += sims[i]->processedEventCount;
+
+    for (;;) {
+        dzU64 startTime = 0U;
+
+        if (!dzSimGetNextEventTime(sims, simCount, &startTime)
+            || startTime > endTime)
+            break;
+
+        /*
+            NOTE: No event in a window can affect another simulator 
+                  before the window ends, as long as every interaction 
+                  between the simulators takes at least `lookahead`
+                  nanoseconds to take effect
+        */
+
+        dzU64 windowEndTime = endTime;
+
+        if (config.lookahead - 1U < endTime - startTime)
+            windowEndTime = startTime + (config.lookahead - 1U);
+
+        (void) pthread_mutex_lock(&(ctx.mutex));
+
+        ctx.windowEndTime = windowEndTime;
+
+        ctx.nextSimIndex = 0U, ctx.activeThreadCount = spawnedThreadCount;
+
+        ctx.generation++;
+
+        (void) pthread_cond_broadcast(&(ctx.startCond));
+        (void) pthread_mutex_unlock(&(ctx.mutex));
+
+        // NOTE: The calling thread takes part in the work as well
+        dzSimRunWindow(&ctx);
+
+        (void) pthread_mutex_lock(&(ctx.mutex));
+
+        while (ctx.activeThreadCount > 0U)
+            (void) pthread_cond_wait(&(ctx.doneCond), &(ctx.mutex));
+
+        (void) pthread_mutex_unlock(&(ctx.mutex));
+
+        // NOTE: All simulators are now synchronized at the end of the window
+        for (dzU32 i = 0U; i < simCount; i++)
+            if (sims[i]->currentTime < windowEndTime)
+                sims[i]->currentTime = windowEndTime;
+
+        if (config.onSync != NULL)
+            config.onSync(sims, simCount, windowEndTime, config.ctx);
+    }
+
+    (void) pthread_mutex_lock(&(ctx.mutex));
+
+    ctx.isDone = true, ctx.generation++;
+
+    (void) pthread_cond_broadcast(&(ctx.startCond));
+    (void) pthread_mutex_unlock(&(ctx.mutex));
+
+    for (dzU32 i = 0U; i < spawnedThreadCount; i++)
+        (void) pthread_join(threads[i], NULL);
+
+    free(threads);
+
+    (void) pthread_cond_destroy(&(ctx.doneCond));
+    (void) pthread_cond_destroy(&(ctx.startCond));
+
+    (void) pthread_mutex_destroy(&(ctx.mutex));
+
+    dzU64 newProcessedEventCount = 0U;
+
+    for (dzU32 i = 0U; i < simCount; i++)
+        newProcessedEventCount += sims[i]->processedEventCount;
+
+    return newProcessedEventCount - oldProcessedEventCount;
+}
+
+/* 
+    Schedules `callback` to be called with `ctx`, 
+    `delay` nanoseconds after the current time of `sim`.
+*/
+dzResult dzSimSchedule(dzSim *sim,
+                       dzU64 delay,
+                       dzSimEventCallback callback,
+                       void *ctx) {
+    if (sim == NULL || callback == NULL
+        || delay > (UINT64_MAX - sim->currentTime))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: Events scheduled at the same time are processed in FIFO order
+    return dzSimPushEvent(sim,
+                          (dzSimEvent) { .time = sim->currentTime + delay,
+                                         .sequence = sim->nextSequence++,
+                                         .callback = callback,
+                                         .ctx = ctx });
+}
+
+/* 
+    Processes the earliest event in `sim`, and returns `false` 
+    if there are no events left.
+*/
+dzBool dzSimStep(dzSim *sim) {
+    if (sim == NULL || sim->pendingEventCount == 0U) return false;
+
+    dzSimEvent event;
+
+    // NOTE: The event is copied out, since its callback may schedule more
+    dzSimPopEvent(sim, &event);
+
+    sim->currentTime = event.time;
+
+    sim->processedEventCount++;
+
+    event.callback(sim, event.ctx);
+
+    return true;
+}
+
+/* 
+    Schedules `op` to be started `delay` nanoseconds after 
+    the current time of `sim`.
+*/
+dzResult dzSimSubmitOp(dzSim *sim, dzSimOp *op, dzU64 delay) {
+    if (sim == NULL || op == NULL || op->die == NULL)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    op->result = DZ_RESULT_OK;
+
+    op->issueTime = sim->currentTime + delay;
+
+    op->startTime = op->endTime = UINT64_MAX;
+
+    op->suspendCount = 0U;
+
+    op->eventIndex = DZ_SIM_INVALID_EVENT_INDEX;
+
+    return dzSimSchedule(sim, delay, dzSimStartOp, op);
+}
+
+/* Private Functions ======================================================> */
+
+/* Called when `ctx` (a `dzSimOp`) is completed. */
+static void dzSimCompleteOp(dzSim *sim, void *ctx) {
+    dzSimOp *op = ctx;
+
+    op->endTime = sim->currentTime;
+
+    op->eventIndex = DZ_SIM_INVALID_EVENT_INDEX;
+
+    if (dzDieGetActiveOp(op->die) == op) dzDieSetActiveOp(op->die, NULL);
+
+    if (op->onComplete != NULL) op->onComplete(sim, op);
+}
+
+/* Called when `ctx` (a `dzSimOp`) is started. */
+static void dzSimStartOp(dzSim *sim, void *ctx) {
+    dzSimOp *op = ctx;
+
+    dzU64 readyTime = dzSimGetOpReadyTime(op);
+
+    dzU64 eventIndex = DZ_SIM_INVALID_EVENT_INDEX;
+
+    if (readyTime > sim->currentTime)
+        eventIndex = dzSimFindSuspendableOp(sim, op, &readyTime);
+
+    // NOTE: Wait until the die can accept `op`, then retry in arrival order
+    if (readyTime > sim->currentTime
+        && eventIndex == DZ_SIM_INVALID_EVENT_INDEX) {
+        dzU64 delay = readyTime - sim->currentTime;
+
+        if (dzSimSchedule(sim, delay, dzSimStartOp, op) != DZ_RESULT_OK) {
+            op->result = DZ_RESULT_NO_MEMORY;
+
+            dzSimCompleteOp(sim, op);
+        }
+
+        return;
+    }
+
+    op->startTime = sim->currentTime;
+
+    if (op->ppaCount > 0U)
+        op->result = dzSimRunMultiPlaneOp(op);
+    else
+        op->result = dzSimRunSinglePlaneOp(op);
+
+    dzU64 latency = 0U;
+
+    // NOTE: Failed operations complete immediately
+    if (op->result == DZ_RESULT_OK) {
+        dzU64 endTime = (eventIndex != DZ_SIM_INVALID_EVENT_INDEX)
+                            ? dzSimSuspendOp(sim, op, eventIndex)
+                            : dzSimReserveOp(op);
+
+        latency = endTime - op->startTime;
+
+        // NOTE: Only one program or erase operation can be in progress
+        if (op->type == DZ_SIM_OP_TYPE_PROGRAM
+            || op->type == DZ_SIM_OP_TYPE_ERASE)
+            dzDieSetActiveOp(op->die, op);
+    }
+
+    if (dzSimSchedule(sim, latency, dzSimCompleteOp, op) != DZ_RESULT_OK) {
+        op->result = DZ_RESULT_NO_MEMORY;
+
+        dzSimCompleteOp(sim, op);
+    }
+}
+
+/* 
+    Returns the index of the event that completes the operation 
+    that `op` (a read) can suspend, or `DZ_SIM_INVALID_EVENT_INDEX` 
+    if there is none, in which case `*readyTime` may be moved earlier.
+*/
+static dzU64 dzSimFindSuspendableOp(const dzSim *sim,
+                                    const dzSimOp *op,
+                                    dzU64 *readyTime) {
+    if (op->type != DZ_SIM_OP_TYPE_READ || sim->config.maxSuspendCount == 0U)
+        return DZ_SIM_INVALID_EVENT_INDEX;
+
+    dzU64 resumeTime = dzDieGetResumeTime(op->die);
+
+    // NOTE: Retry as soon as the die resumes the suspended operation
+    if (resumeTime > sim->currentTime) {
+        if (resumeTime < *readyTime) *readyTime = resumeTime;
+
+        return DZ_SIM_INVALID_EVENT_INDEX;
+    }
+
+    /*
+        NOTE: Cache programs are never suspended, since their completion 
+              events fire before their array operations end
+    */
+    const dzSimOp *victim = dzDieGetActiveOp(op->die);
+
+    if (victim == NULL || victim->eventIndex >= sim->pendingEventCount)
+        return DZ_SIM_INVALID_EVENT_INDEX;
+
+    const dzSimEvent *event = &(sim->events[victim->eventIndex]);
+
+    return (event->ctx == victim && event->time > sim->currentTime
+            && victim->suspendCount < sim->config.maxSuspendCount)
+               ? victim->eventIndex
+               : DZ_SIM_INVALID_EVENT_INDEX;
+}
+
+/* 
+    Stores the time of the earliest event in the `simCount` simulators 
+    in `sims` into `time`, and returns `false` if there are no events left.
+*/
+DZ_API_STATIC_INLINE dzBool dzSimGetNextEventTime(dzSim **sims,
+                                                  dzU32 simCount,
+                                                  dzU64 *time) {
+    dzBool result = false;
+
+    for (dzU32 i = 0U; i < simCount; i++) {
+        if (sims[i]->pendingEventCount == 0U) continue;
+
+        if (!result || sims[i]->events[0].time < *time)
+            *time = sims[i]->events[0].time;
+
+        result = true;
+    }
+
+    return result;
+}
+
+/* Returns the mask of all planes accessed by `op`. */
+DZ_API_STATIC_INLINE dzU64 dzSimGetOpPlaneMask(const dzSimOp *op) {
+    if (op->ppaCount == 0U) return UINT64_C(1) << op->ppa.planeId;
+
+    dzU64 planeMask = UINT64_C(0);
+
+    for (dzU64 i = 0U; i < op->ppaCount; i++)
+        planeMask |= UINT64_C(1) << op->ppas[i].planeId;
+
+    return planeMask;
+}
+
+/* Returns the earliest time at which the die can accept `op`. */
+DZ_API_STATIC_INLINE dzU64 dzSimGetOpReadyTime(const dzSimOp *op) {
+    dzU64 arrayReadyTime = dzDieGetReadyTime(op->die);
+    dzU64 cacheReadyTime = dzDieGetCacheReadyTime(op->die);
+
+    switch (op->type) {
+        // NOTE: Data can be loaded while the array is still programming
+        case DZ_SIM_OP_TYPE_PROGRAM:
+        case DZ_SIM_OP_TYPE_CACHE_PROGRAM:
+            return cacheReadyTime;
+
+        // NOTE: The next page can be sensed while the last one is read out
+        case DZ_SIM_OP_TYPE_CACHE_READ:
+            return arrayReadyTime;
+
+        default:
+            return (arrayReadyTime > cacheReadyTime) ? arrayReadyTime
+                                                     : cacheReadyTime;
+    }
+}
+
+/* Returns `true` if `e1` must be processed before `e2`. */
+DZ_API_STATIC_INLINE dzBool dzSimIsEarlierEvent(const dzSimEvent *e1,
+                                                const dzSimEvent *e2) {
+    return (e1->time < e2->time)
+           || (e1->time == e2->time && e1->sequence < e2->sequence);
+}
+
+/* Stores `event` in the `index`-th slot of the event queue of `sim`. */
+DZ_API_STATIC_INLINE void dzSimPlaceEvent(dzSim *sim,
+                                          dzU64 index,
+                                          const dzSimEvent *event) {
+    sim->events[index] = *event;
+
+    // NOTE: Completion events keep track of their slots for suspensions
+    if (event->callback == dzSimCompleteOp)
+        ((dzSimOp *) event->ctx)->eventIndex = index;
+}
+
+/* Runs `op` on its die as a multi-plane operation. */
+static dzResult dzSimRunMultiPlaneOp(dzSimOp *op) {
+    switch (op->type) {
+        case DZ_SIM_OP_TYPE_PROGRAM:
+        case DZ_SIM_OP_TYPE_CACHE_PROGRAM:
+            return dzDieProgramMultiPlane(op->die,
+                                          op->ppas,
+                                          op->buffers,
+                                          op->ppaCount);
+
+        case DZ_SIM_OP_TYPE_READ:
+        case DZ_SIM_OP_TYPE_CACHE_READ:
+            return dzDieReadMultiPlane(op->die,
+                                       op->ppas,
+                                       op->buffers,
+                                       op->ppaCount);
+
+        case DZ_SIM_OP_TYPE_ERASE:
+            return dzDieEraseMultiPlane(op->die, op->ppas, op->ppaCount);
+
+        default:
+            return DZ_RESULT_INVALID_ARGUMENT;
+    }
+}
+
+/* Runs `op` on its die as a single-plane operation. */
+static dzResult dzSimRunSinglePlaneOp(dzSimOp *op) {
+    switch (op->type) {
+        case DZ_SIM_OP_TYPE_PROGRAM:
+        case DZ_SIM_OP_TYPE_CACHE_PROGRAM:
+            return dzDieProgramPage(op->die, op->ppa, op->buffer);
+
+        case DZ_SIM_OP_TYPE_READ:
+        case DZ_SIM_OP_TYPE_CACHE_READ:
+            return dzDieReadPage(op->die, op->ppa, op->buffer);
+
+        case DZ_SIM_OP_TYPE_ERASE:
+            return dzDieEraseBlock(op->die, op->ppa);
+
+        default:
+            return DZ_RESULT_INVALID_ARGUMENT;
+    }
+}
+
+/* 
+    Reserves the bus of the channel of `op` for `duration` nanoseconds, 
+    no earlier than `time`, and returns the time at which it is granted.
+*/
+static dzU64 dzSimReserveBus(const dzSimOp *op, dzU64 time, dzU64 duration) {
+    if (op->channel == NULL || duration == 0U) return time;
+
+    // NOTE: Transfers are granted in the order in which they are reserved
+    if (time < dzChannelGetBusReadyTime(op->channel))
+        time = dzChannelGetBusReadyTime(op->channel);
+
+    (void) dzChannelMarkBusAsBusy(op->channel, time, duration);
+
+    return time;
+}
+
+/* 
+    Reserves the array and the cache register of the die for `op`, 
+    which has just been run, and returns the time at which it completes.
+*/
+static dzU64 dzSimReserveOp(dzSimOp *op) {
+    dzU64 latency = dzSimToNanoseconds(dzDieGetLastLatency(op->die));
+
+    dzU64 transferTime = dzDieGetPageTransferTime(op->die)
+                         * ((op->ppaCount > 0U) ? op->ppaCount : 1U);
+
+    dzU64 arrayStartTime = op->startTime, arrayDuration = latency;
+    dzU64 cacheStartTime = op->startTime, cacheEndTime = op->startTime;
+
+    switch (op->type) {
+        case DZ_SIM_OP_TYPE_PROGRAM:
+        case DZ_SIM_OP_TYPE_CACHE_PROGRAM:
+            /* NOTE: Data in, then wait for the array to copy it */
+
+            arrayStartTime = dzSimReserveBus(op, op->startTime, transferTime)
+                             + transferTime;
+
+            if (arrayStartTime < dzDieGetReadyTime(op->die))
+                arrayStartTime = dzDieGetReadyTime(op->die);
+
+            // NOTE: Cache programs free the cache register once it is copied
+            cacheEndTime = (op->type == DZ_SIM_OP_TYPE_CACHE_PROGRAM)
+                               ? arrayStartTime
+                               : arrayStartTime + latency;
+
+            break;
+
+        case DZ_SIM_OP_TYPE_CACHE_READ:
+            /* NOTE: Sense, then wait for the cache register, then data out */
+
+            cacheStartTime = op->startTime + latency;
+
+            if (cacheStartTime < dzDieGetCacheReadyTime(op->die))
+                cacheStartTime = dzDieGetCacheReadyTime(op->die);
+
+            // NOTE: The data register is held until it is copied
+            arrayDuration = cacheStartTime - op->startTime;
+
+            cacheEndTime = dzSimReserveBus(op, cacheStartTime, transferTime)
+                           + transferTime;
+
+            break;
+
+        case DZ_SIM_OP_TYPE_READ:
+            cacheEndTime = dzSimReserveBus(op,
+                                           op->startTime + latency,
+                                           transferTime)
+                           + transferTime;
+
+            break;
+
+        default:
+            cacheEndTime = op->startTime + latency;
+
+            break;
+    }
+
+    (void) dzDieMarkAsBusy(op->die,
+                           dzSimGetOpPlaneMask(op),
+                           arrayStartTime,
+                           arrayDuration);
+
+    (void) dzDieMarkCacheAsBusy(op->die,
+                                cacheStartTime,
+                                cacheEndTime - cacheStartTime);
+
+    return cacheEndTime;
+}
+
+/* 
+    Suspends the operation completed by the `eventIndex`-th event 
+    in `sim` for `op` (a read), which has just been run, 
+    and returns the time at which `op` completes.
+*/
+static dzU64 dzSimSuspendOp(dzSim *sim, dzSimOp *op, dzU64 eventIndex) {
+    dzU64 latency = dzSimToNanoseconds(dzDieGetLastLatency(op->die));
+
+    dzU64 transferTime = dzDieGetPageTransferTime(op->die)
+                         * ((op->ppaCount > 0U) ? op->ppaCount : 1U);
+
+    /* NOTE: Suspend, sense, data out, then resume the suspended operation */
+
+    dzU64 dataOutTime = op->startTime + sim->config.suspendOverhead + latency;
+
+    if (op->channel != NULL && transferTime > 0U
+        && dataOutTime < dzChannelGetBusReadyTime(op->channel))
+        dataOutTime = dzChannelGetBusReadyTime(op->channel);
+
+    dzU64 duration = (dataOutTime + transferTime) - op->startTime;
+
+    // NOTE: The bus is only reserved once the die accepts the suspension
+    if (dzDieSuspend(op->die, dzSimGetOpPlaneMask(op), op->startTime, duration)
+        != DZ_RESULT_OK)
+        return dzSimReserveOp(op);
+
+    dzU64 endTime = dzSimReserveBus(op, dataOutTime, transferTime)
+                    + transferTime;
+
+    dzSimEvent event = sim->events[eventIndex];
+
+    ((dzSimOp *) event.ctx)->suspendCount++;
+
+    // NOTE: A delayed event can only move down the event queue
+    event.time += duration;
+
+    dzSimSiftDown(sim, eventIndex, event);
+
+    return endTime;
+}
+
+/* Removes the earliest event in `sim`, and stores it in `event`. */
+static void dzSimPopEvent(dzSim *sim, dzSimEvent *event) {
+    dzSimEvent *events = sim->events;
+
+    *event = events[0];
+
+    dzU64 eventCount = --(sim->pendingEventCount);
+
+    if (eventCount == 0U) return;
+
+    dzSimSiftDown(sim, 0U, events[eventCount]);
+}
+
+/* 
+    Moves `event` down from the `index`-th slot of the event queue 
+    of `sim`, until the heap property is restored.
+*/
+static void dzSimSiftDown(dzSim *sim, dzU64 index, dzSimEvent event) {
+    dzSimEvent *events = sim->events;
+
+    dzU64 eventCount = sim->pendingEventCount;
+
+    // NOTE: Moves the hole at `index` down, instead of swapping events
+    for (;;) {
+        dzU64 firstChildIndex = (DZ_SIM_EVENT_QUEUE_ARITY * index) + 1U;
+
+        if (firstChildIndex >= eventCount) break;
+
+        dzU64 lastChildIndex = firstChildIndex + DZ_SIM_EVENT_QUEUE_ARITY;
+
+        if (lastChildIndex > eventCount) lastChildIndex = eventCount;
+
+        dzU64 minChildIndex = firstChildIndex;
+
+        for (dzU64 i = firstChildIndex + 1U; i < lastChildIndex; i++)
+            if (dzSimIsEarlierEvent(&events[i], &events[minChildIndex]))
+                minChildIndex = i;
+
+        if (!dzSimIsEarlierEvent(&events[minChildIndex], &event)) break;
+
+        dzSimPlaceEvent(sim, index, &events[minChildIndex]);
+
+        index = minChildIndex;
+    }
+
+    dzSimPlaceEvent(sim, index, &event);
+}
+
+/* Inserts `event` into the event queue of `sim`. */
+static dzResult dzSimPushEvent(dzSim *sim, dzSimEvent event) {
+    if (sim->pendingEventCount == sim->eventCapacity) {
+        dzU64 newEventCapacity = 2U * sim->eventCapacity;
+
+        if (newEventCapacity > (SIZE_MAX / sizeof *(sim->events)))
+            return DZ_RESULT_NO_MEMORY;
+
+        dzSimEvent *newEvents = realloc(sim->events,
+                                        newEventCapacity
+                                            * sizeof *newEvents);
+
+        if (newEvents == NULL) return DZ_RESULT_NO_MEMORY;
+
+        sim->events = newEvents;
+        sim->eventCapacity = newEventCapacity;
+    }
+
+    dzSimEvent *events = sim->events;
+
+    dzU64 index = sim->pendingEventCount++;
+
+    // NOTE: Moves the hole at the bottom up, instead of swapping events
+    while (index > 0U) {
+        dzU64 parentIndex = (index - 1U) / DZ_SIM_EVENT_QUEUE_ARITY;
+
+        if (!dzSimIsEarlierEvent(&event, &events[parentIndex])) break;
+
+        dzSimPlaceEvent(sim, index, &events[parentIndex]);
+
+        index = parentIndex;
+    }
+
+    dzSimPlaceEvent(sim, index, &event);
+
+    return DZ_RESULT_OK;
+}
+
+/* 
+    Runs the remaining simulators in `ctx` until the end of 
+    the current window.
+*/
+static void dzSimRunWindow(dzSimParallelContext *ctx) {
+    for (;;) {
+        dzU32 simIndex = __atomic_fetch_add(&(ctx->nextSimIndex),
+                                            1U,
+                                            __ATOMIC_RELAXED);
+
+        if (simIndex >= ctx->simCount) break;
+
+        (void) dzSimRun(ctx->sims[simIndex], ctx->windowEndTime);
+    }
+}
+
+/* Runs the windows of the parallel run in `ctx`, until it is done. */
+static void *dzSimRunWindowWorker(void *ctx) {
+    dzSimParallelContext *parallelCtx = ctx;
+
+    dzU64 generation = 0U;
+
+    for (;;) {
+        (void) pthread_mutex_lock(&(parallelCtx->mutex));
+
+        while (parallelCtx->generation == generation)
+            (void) pthread_cond_wait(&(parallelCtx->startCond),
+                                     &(parallelCtx->mutex));
+
+        generation = parallelCtx->generation;
+
+        dzBool isDone = parallelCtx->isDone;
+
+        (void) pthread_mutex_unlock(&(parallelCtx->mutex));
+
+        if (isDone) break;
+
+        dzSimRunWindow(parallelCtx);
+
+        (void) pthread_mutex_lock(&(parallelCtx->mutex));
+
+        if (--parallelCtx->activeThreadCount == 0U)
+            (void) pthread_cond_signal(&(parallelCtx->doneCond));
+
+        (void) pthread_mutex_unlock(&(parallelCtx->mutex));
+    }
+
+    return NULL;
+}
+
+/* Returns the given `latency` in milliseconds, in nanoseconds. */
+DZ_API_STATIC_INLINE dzU64 dzSimToNanoseconds(dzF64 latency) {
+    return (latency > 0.0) ? (dzU64) ((latency * 1e6) + 0.5) : 0U;
+}
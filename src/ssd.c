@@ -0,0 +1,405 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// TODO: ...
+
+/* Typedefs ===============================================================> */
+
+/* A structure that represents a solid-state drive. */
+struct dzSSD_ {
+    dzSSDConfig config;
+    dzChannelConfig channelConfig;
+    dzChannel **channels;
+    dzDie **dies;  // Indexed by (`channelId`, `chipId`, `dieId`)
+    dzU64 dieCount;
+    dzU32 chipCountPerChannel;
+    dzU32 dieCountPerChip;
+};
+
+/* Constants ==============================================================> */
+
+/* A constant that represents an invalid die index. */
+static const dzU64 DZ_SSD_INVALID_DIE_INDEX = UINT64_MAX;
+
+/* Private Variables ======================================================> */
+
+// TODO: ...
+
+/* Private Function Prototypes ============================================> */
+
+/* 
+    Returns the index of the die that `ppa` is pointing to within `ssd`, 
+    or `DZ_SSD_INVALID_DIE_INDEX` if there is no such die.
+*/
+DZ_API_STATIC_INLINE dzU64 dzSSDGetDieIndex(const dzSSD *ssd, dzPPA ppa);
+
+/* Returns the first physical page address of the `dieIndex`-th die. */
+DZ_API_STATIC_INLINE dzPPA dzSSDGetFirstPPAOfDie(const dzSSD *ssd,
+                                                 dzU64 dieIndex);
+
+/* Returns an invalid physical page address. */
+DZ_API_STATIC_INLINE dzPPA dzSSDGetInvalidPPA(void);
+
+/* Public Functions =======================================================> */
+
+/* Initializes `*ssd` with the given `config`. */
+dzResult dzSSDInit(dzSSD **ssd, dzSSDConfig config) {
+    // clang-format off
+
+    if (ssd == NULL
+        || config.channelConfig == NULL
+        || config.channelConfig->chipConfig == NULL
+        || config.channelCount == 0U)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // clang-format on
+
+    dzSSD *newSSD = malloc(sizeof *newSSD);
+
+    if (newSSD == NULL) return DZ_RESULT_NO_MEMORY;
+
+    {
+        // NOTE: The channel configuration is owned by the caller
+        newSSD->channelConfig = *(config.channelConfig);
+
+        newSSD->config = config;
+        newSSD->config.channelConfig = &(newSSD->channelConfig);
+
+        newSSD->chipCountPerChannel = config.channelConfig->chipCount;
+        newSSD->dieCountPerChip = config.channelConfig->chipConfig->dieCount;
+
+        newSSD->dieCount = (dzU64) config.channelCount
+                           * newSSD->chipCountPerChannel
+                           * newSSD->dieCountPerChip;
+
+        newSSD->channels = calloc(config.channelCount,
+                                  sizeof *(newSSD->channels));
+
+        newSSD->dies = calloc(newSSD->dieCount, sizeof *(newSSD->dies));
+    }
+
+    if (newSSD->channels == NULL || newSSD->dies == NULL) {
+        free(newSSD->channels), free(newSSD->dies), free(newSSD);
+
+        return DZ_RESULT_NO_MEMORY;
+    }
+
+    for (dzU32 i = 0U; i < config.channelCount; i++) {
+        dzChannelConfig channelConfig = newSSD->channelConfig;
+
+        channelConfig.channelId = i;
+
+        if (dzChannelInit(&(newSSD->channels[i]), channelConfig)
+            != DZ_RESULT_OK) {
+            dzSSDDeinit(newSSD);
+
+            return DZ_RESULT_INTERNAL_ERROR;
+        }
+
+        // NOTE: Flatten the hierarchy, so that dies can be found in O(1)
+        for (dzU32 j = 0U; j < newSSD->chipCountPerChannel; j++) {
+            dzChip *chip = dzChannelGetChip(newSSD->channels[i], j);
+
+            for (dzU32 k = 0U; k < newSSD->dieCountPerChip; k++) {
+                dzPPA ppa = { .channelId = i, .chipId = j, .dieId = k };
+
+                newSSD->dies[dzSSDGetDieIndex(newSSD, ppa)] =
+                    dzChipGetDie(chip, k);
+            }
+        }
+    }
+
+    *ssd = newSSD;
+
+    return DZ_RESULT_OK;
+}
+
+/* Releases the memory allocated for `ssd`. */
+void dzSSDDeinit(dzSSD *ssd) {
+    if (ssd == NULL) return;
+
+    for (dzU32 i = 0U; i < ssd->config.channelCount; i++)
+        dzChannelDeinit(ssd->channels[i]);
+
+    free(ssd->channels), free(ssd->dies), free(ssd);
+}
+
+/* ========================================================================> */
+
+/* Returns the `channelId`-th channel in `ssd`. */
+dzChannel *dzSSDGetChannel(const dzSSD *ssd, dzU64 channelId) {
+    return (ssd != NULL && channelId < ssd->config.channelCount)
+               ? ssd->channels[channelId]
+               : NULL;
+}
+
+/* Returns the number of channels in `ssd`. */
+dzU32 dzSSDGetChannelCount(const dzSSD *ssd) {
+    return (ssd != NULL) ? ssd->config.channelCount : 0U;
+}
+
+/* Returns the die that `ppa` is pointing to within `ssd`. */
+dzDie *dzSSDGetDie(const dzSSD *ssd, dzPPA ppa) {
+    dzU64 dieIndex = dzSSDGetDieIndex(ssd, ppa);
+
+    return (dieIndex != DZ_SSD_INVALID_DIE_INDEX) ? ssd->dies[dieIndex]
+                                                  : NULL;
+}
+
+/* Returns the total number of dies in `ssd`. */
+dzU64 dzSSDGetDieCount(const dzSSD *ssd) {
+    return (ssd != NULL) ? ssd->dieCount : 0U;
+}
+
+/* 
+    Returns the lookahead of `ssd` for a parallel run with 
+    one simulator per channel, in nanoseconds.
+*/
+dzU64 dzSSDGetLookahead(const dzSSD *ssd) {
+    if (ssd == NULL) return 0U;
+
+    dzU64 result = UINT64_MAX;
+
+    /*
+        NOTE: Channels never share a die or a bus, so the lookahead only 
+              bounds how often the simulators synchronize; a page transfer 
+              is the shortest timed step that any channel can take
+    */
+
+    for (dzU64 i = 0U; i < ssd->config.channelCount; i++) {
+        dzDie *die = ssd->dies[i * ssd->chipCountPerChannel
+                               * ssd->dieCountPerChip];
+
+        dzU64 transferTime = dzDieGetPageTransferTime(die);
+
+        if (transferTime < result) result = transferTime;
+    }
+
+    return (result > 0U) ? result : 1U;
+}
+
+/* Returns the first physical page address within `ssd`. */
+dzPPA dzSSDGetFirstPPA(const dzSSD *ssd) {
+    return (ssd != NULL) ? dzSSDGetFirstPPAOfDie(ssd, 0U)
+                         : dzSSDGetInvalidPPA();
+}
+
+/* Returns the next physical page address following `ppa` within `ssd`. */
+dzPPA dzSSDGetNextPPA(const dzSSD *ssd, dzPPA ppa) {
+    dzU64 dieIndex = dzSSDGetDieIndex(ssd, ppa);
+
+    if (dieIndex == DZ_SSD_INVALID_DIE_INDEX) return dzSSDGetInvalidPPA();
+
+    dzPPA nextPPA = dzDieGetNextPPA(ssd->dies[dieIndex], ppa);
+
+    if (nextPPA.pageId != DZ_PAGE_INVALID_ID) return nextPPA;
+
+    return (dieIndex + 1U < ssd->dieCount)
+               ? dzSSDGetFirstPPAOfDie(ssd, dieIndex + 1U)
+               : dzSSDGetInvalidPPA();
+}
+
+/* ========================================================================> */
+
+/* Returns the total number of invalid pages in `ssd`. */
+dzU64 dzSSDGetInvalidPageCount(const dzSSD *ssd) {
+    if (ssd == NULL) return 0U;
+
+    dzU64 result = 0U;
+
+    for (dzU64 i = 0U; i < ssd->dieCount; i++)
+        result += dzDieGetInvalidPageCount(ssd->dies[i]);
+
+    return result;
+}
+
+/* Returns the total number of pages in `ssd`. */
+dzU64 dzSSDGetPageCount(const dzSSD *ssd) {
+    if (ssd == NULL) return 0U;
+
+    dzU64 result = 0U;
+
+    for (dzU64 i = 0U; i < ssd->dieCount; i++)
+        result += dzDieGetPageCount(ssd->dies[i]);
+
+    return result;
+}
+
+/* Returns the total number of valid pages in `ssd`. */
+dzU64 dzSSDGetValidPageCount(const dzSSD *ssd) {
+    if (ssd == NULL) return 0U;
+
+    dzU64 result = 0U;
+
+    for (dzU64 i = 0U; i < ssd->dieCount; i++)
+        result += dzDieGetValidPageCount(ssd->dies[i]);
+
+    return result;
+}
+
+/* ========================================================================> */
+
+/* Returns the total number of program operations performed on `ssd`. */
+dzU64 dzSSDGetTotalProgramCount(const dzSSD *ssd) {
+    if (ssd == NULL) return 0U;
+
+    dzU64 result = 0U;
+
+    for (dzU64 i = 0U; i < ssd->dieCount; i++)
+        result += dzDieGetTotalProgramCount(ssd->dies[i]);
+
+    return result;
+}
+
+/* Returns the total number of read operations performed on `ssd`. */
+dzU64 dzSSDGetTotalReadCount(const dzSSD *ssd) {
+    if (ssd == NULL) return 0U;
+
+    dzU64 result = 0U;
+
+    for (dzU64 i = 0U; i < ssd->dieCount; i++)
+        result += dzDieGetTotalReadCount(ssd->dies[i]);
+
+    return result;
+}
+
+/* Returns the total number of erase operations performed on `ssd`. */
+dzU64 dzSSDGetTotalEraseCount(const dzSSD *ssd) {
+    if (ssd == NULL) return 0U;
+
+    dzU64 result = 0U;
+
+    for (dzU64 i = 0U; i < ssd->dieCount; i++)
+        result += dzDieGetTotalEraseCount(ssd->dies[i]);
+
+    return result;
+}
+
+/* ========================================================================> */
+
+/* Writes `src.ptr` to the page corresponding to `ppa` in `ssd`. */
+dzResult dzSSDProgramPage(dzSSD *ssd, dzPPA ppa, dzByteArray src) {
+    dzDie *die = dzSSDGetDie(ssd, ppa);
+
+    if (die == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    return dzDieProgramPage(die, ppa, src);
+}
+
+/* 
+    Reads data from the page corresponding to `ppa` in `ssd`, 
+    and copies it to `dst.ptr`. 
+*/
+dzResult dzSSDReadPage(dzSSD *ssd, dzPPA ppa, dzByteArray dst) {
+    dzDie *die = dzSSDGetDie(ssd, ppa);
+
+    if (die == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    return dzDieReadPage(die, ppa, dst);
+}
+
+/* Erases the block corresponding to `pba` in `ssd`. */
+dzResult dzSSDEraseBlock(dzSSD *ssd, dzPBA pba) {
+    dzDie *die = dzSSDGetDie(ssd, pba);
+
+    if (die == NULL) return DZ_RESULT_INVALID_ARGUMENT;
+
+    return dzDieEraseBlock(die, pba);
+}
+
+/* 
+    Routes `op` to the die and the channel that its address is pointing to, 
+    and schedules it to be started `delay` nanoseconds after 
+    the current time of `sim`.
+*/
+dzResult dzSSDSubmitOp(dzSSD *ssd, dzSim *sim, dzSimOp *op, dzU64 delay) {
+    if (ssd == NULL || op == NULL || (op->ppaCount > 0U && op->ppas == NULL))
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    dzPPA ppa = (op->ppaCount > 0U) ? op->ppas[0] : op->ppa;
+
+    dzU64 dieIndex = dzSSDGetDieIndex(ssd, ppa);
+
+    if (dieIndex == DZ_SSD_INVALID_DIE_INDEX)
+        return DZ_RESULT_INVALID_ARGUMENT;
+
+    // NOTE: All planes of a multi-plane operation must be in the same die
+    for (dzU64 i = 1U; i < op->ppaCount; i++)
+        if (dzSSDGetDieIndex(ssd, op->ppas[i]) != dieIndex)
+            return DZ_RESULT_INVALID_ARGUMENT;
+
+    op->die = ssd->dies[dieIndex];
+    op->channel = ssd->channels[ppa.channelId];
+
+    return dzSimSubmitOp(sim, op, delay);
+}
+
+/* Private Functions ======================================================> */
+
+/* 
+    Returns the index of the die that `ppa` is pointing to within `ssd`, 
+    or `DZ_SSD_INVALID_DIE_INDEX` if there is no such die.
+*/
+DZ_API_STATIC_INLINE dzU64 dzSSDGetDieIndex(const dzSSD *ssd, dzPPA ppa) {
+    // clang-format off
+
+    if (ssd == NULL
+        || ppa.channelId >= ssd->config.channelCount
+        || ppa.chipId >= ssd->chipCountPerChannel
+        || ppa.dieId >= ssd->dieCountPerChip)
+        return DZ_SSD_INVALID_DIE_INDEX;
+
+    // clang-format on
+
+    return ((ppa.channelId * ssd->chipCountPerChannel) + ppa.chipId)
+               * ssd->dieCountPerChip
+           + ppa.dieId;
+}
+
+/* Returns the first physical page address of the `dieIndex`-th die. */
+DZ_API_STATIC_INLINE dzPPA dzSSDGetFirstPPAOfDie(const dzSSD *ssd,
+                                                 dzU64 dieIndex) {
+    dzPPA ppa = dzDieGetFirstPPA(ssd->dies[dieIndex]);
+
+    dzU64 chipIndex = dieIndex / ssd->dieCountPerChip;
+
+    ppa.channelId = chipIndex / ssd->chipCountPerChannel;
+    ppa.chipId = chipIndex % ssd->chipCountPerChannel;
+
+    return ppa;
+}
+
+/* Returns an invalid physical page address. */
+DZ_API_STATIC_INLINE dzPPA dzSSDGetInvalidPPA(void) {
+    return (dzPPA) { .channelId = DZ_CHANNEL_INVALID_ID,
+                     .chipId = DZ_CHIP_INVALID_ID,
+                     .dieId = DZ_DIE_INVALID_ID,
+                     .planeId = DZ_PLANE_INVALID_ID,
+                     .blockId = DZ_BLOCK_INVALID_ID,
+                     .pageId = DZ_PAGE_INVALID_ID };
+}
@@ -24,6 +24,7 @@
 
 #include <limits.h>
 #include <math.h>
+#include <string.h>
 
 #include "ssdeez.h"
 
@@ -31,65 +32,238 @@
 
 #define BITWISE_ROTATE_LEFT_U64(x, k) (((x) << (k)) | ((x) >> (64 - (k))))
 
+// clang-format off
+
+#define DZ_UTILS_ZIGGURAT_LAYER_COUNT  128U
+#define DZ_UTILS_ZIGGURAT_TAIL_START   3.442619855899
+
+// clang-format on
+
+#if defined(_MSC_VER)
+    #define DZ_UTILS_THREAD_LOCAL __declspec(thread)
+#else
+    #define DZ_UTILS_THREAD_LOCAL __thread
+#endif
+
 /* Typedefs ===============================================================> */
 
 // TODO: ...
 
 /* Constants ==============================================================> */
 
-// TODO: ...
+// clang-format off
+
+/* 
+    The right edges of all layers in the Ziggurat for the standard 
+    normal distribution, where the first one is the width of 
+    the rectangle with the same area as the bottom layer.
+*/
+static const dzF64 zigguratEdgeTable[DZ_UTILS_ZIGGURAT_LAYER_COUNT + 1U] = {
+    3.71308624674255050e+00, 3.44261985589900021e+00, 3.22308498458114157e+00,
+    3.08322885821686832e+00, 2.97869625264778026e+00, 2.89434400702152894e+00,
+    2.82312535054891045e+00, 2.76116937238717686e+00, 2.70611357312181955e+00,
+    2.65640641126135968e+00, 2.61097224843184739e+00, 2.56903362592493778e+00,
+    2.53000967238882746e+00, 2.49345452209537211e+00, 2.45901817741183049e+00,
+    2.42642064553374981e+00, 2.39543427801106246e+00, 2.36587137011763859e+00,
+    2.33757524133923678e+00, 2.31041368369876299e+00, 2.28427405967747177e+00,
+    2.25905957386919853e+00, 2.23468639559097948e+00, 2.21108140887870341e+00,
+    2.18818043207604918e+00, 2.16592679374892194e+00, 2.14427018236039535e+00,
+    2.12316570867397658e+00, 2.10257313518923850e+00, 2.08245623799201685e+00,
+    2.06278227450830842e+00, 2.04352153665506764e+00, 2.02464697337738553e+00,
+    2.00613386996347209e+00, 1.98795957412761992e+00, 1.97010326085432652e+00,
+    1.95254572955355665e+00, 1.93526922829662285e+00, 1.91825730086450985e+00,
+    1.90149465310515109e+00, 1.88496703570775903e+00, 1.86866114099448866e+00,
+    1.85256451172809111e+00, 1.83666546025844601e+00, 1.82095299659612553e+00,
+    1.80541676421922848e+00, 1.79004698259985862e+00, 1.77483439558606948e+00,
+    1.75977022489959345e+00, 1.74484612811380035e+00, 1.73005416056373051e+00,
+    1.71538674071366759e+00, 1.70083661856991686e+00, 1.68639684677916812e+00,
+    1.67206075409760091e+00, 1.65782192095402414e+00, 1.64367415686286855e+00,
+    1.62961147947063467e+00, 1.61562809504316096e+00, 1.60171838022137814e+00,
+    1.58787686489057611e+00, 1.57409821602300082e+00, 1.56037722236616894e+00,
+    1.54670877985991040e+00, 1.53308787767404331e+00, 1.51950958476594011e+00,
+    1.50596903686320327e+00, 1.49246142378135405e+00, 1.47898197698992417e+00,
+    1.46552595734271085e+00, 1.45208864288922457e+00, 1.43866531668456354e+00,
+    1.42525125451406010e+00, 1.41184171244705770e+00, 1.39843191413100532e+00,
+    1.38501703773265183e+00, 1.37159220242734259e+00, 1.35815245433014353e+00,
+    1.34469275175354697e+00, 1.33120794966562728e+00, 1.31769278320941408e+00,
+    1.30414185012861683e+00, 1.29054959192619645e+00, 1.27691027356015563e+00,
+    1.26321796145462106e+00, 1.24946649957306821e+00, 1.23564948326336266e+00,
+    1.22176023053999638e+00, 1.20779175041594966e+00, 1.19373670783312869e+00,
+    1.17958738466398816e+00, 1.16533563616475244e+00, 1.15097284214886741e+00,
+    1.13648985201316077e+00, 1.12187692258254224e+00, 1.10712364753403603e+00,
+    1.09221887690727737e+00, 1.07715062489289570e+00, 1.06190596369482426e+00,
+    1.04647090076404536e+00, 1.03083023606819557e+00, 1.01496739525133051e+00,
+    9.98864233492983589e-01, 9.82500803515429011e-01, 9.65855079401149896e-01,
+    9.48902625511306441e-01, 9.31616196615150827e-01, 9.13965251023032277e-01,
+    8.95915352580937685e-01, 8.77427429112923374e-01, 8.58456843193813213e-01,
+    8.38952214297577381e-01, 8.18853906700357292e-01, 7.98092060644056911e-01,
+    7.76583987894759908e-01, 7.54230664454055622e-01, 7.30911910642488838e-01,
+    7.06479611335436464e-01, 6.80747918669154628e-01, 6.53478638739975248e-01,
+    6.24358597336050702e-01, 5.92962942471448318e-01, 5.58692178408185192e-01,
+    5.20656038762060569e-01, 4.77437837296689815e-01, 4.26547986355423514e-01,
+    3.62871431097031960e-01, 2.72320864813964669e-01, 0.00000000000000000e+00
+};
+
+/* 
+    The ratio of the right edge of the layer above to that of 
+    each layer in the Ziggurat, for the standard normal distribution.
+*/
+static const dzF64 zigguratRatioTable[DZ_UTILS_ZIGGURAT_LAYER_COUNT] = {
+    9.27158602609668092e-01, 9.36230289573889207e-01, 9.56607992952922870e-01,
+    9.66096384544888220e-01, 9.71681487982780978e-01, 9.75393852182102172e-01,
+    9.78054117168517756e-01, 9.80060694640488950e-01, 9.81631531523964540e-01,
+    9.82896381127186580e-01, 9.83937545666332514e-01, 9.84809870473353444e-01,
+    9.85551379232894376e-01, 9.86189303081973612e-01, 9.86743679986786359e-01,
+    9.87229597811194348e-01, 9.87658643710329631e-01, 9.88039870157017552e-01,
+    9.88380456312108913e-01, 9.88686171569307826e-01, 9.88961707242854482e-01,
+    9.89210918313024434e-01, 9.89437002543690935e-01, 9.89642635178110464e-01,
+    9.89830071596968786e-01, 9.90001226518352428e-01, 9.90157735783469661e-01,
+    9.90301005050802541e-01, 9.90432248533694382e-01, 9.90552520084321819e-01,
+    9.90662738335856718e-01, 9.90763707189219578e-01, 9.90856132620971941e-01,
+    9.90940636560718069e-01, 9.91017768416578959e-01, 9.91088014699718745e-01,
+    9.91151807102164994e-01, 9.91209529308184956e-01, 9.91261522762455161e-01,
+    9.91308091573961381e-01, 9.91349506699915395e-01, 9.91386009526675882e-01,
+    9.91417814943019504e-01, 9.91445113983844717e-01, 9.91468076108532936e-01,
+    9.91486851167012073e-01, 9.91501571097483492e-01, 9.91512351392366598e-01,
+    9.91519292362930682e-01, 9.91522480228064551e-01, 9.91521988048464586e-01,
+    9.91517876524044217e-01, 9.91510194669438683e-01, 9.91498980380005168e-01,
+    9.91484260898605085e-01, 9.91466053191639496e-01, 9.91444364241222842e-01,
+    9.91419191259001131e-01, 9.91390521825871507e-01, 9.91358333960749682e-01,
+    9.91322596120496558e-01, 9.91283267132149870e-01, 9.91240296057685599e-01,
+    9.91193621990623996e-01, 9.91143173782898956e-01, 9.91088869699480957e-01,
+    9.91030616997289449e-01, 9.90968311423904069e-01, 9.90901836630491251e-01,
+    9.90831063492146669e-01, 9.90755849327522697e-01, 9.90676037008095478e-01,
+    9.90591453945729450e-01, 9.90501910945236208e-01, 9.90407200906388341e-01,
+    9.90307097357237986e-01, 9.90201352797563050e-01, 9.90089696827713639e-01,
+    9.89971834033956943e-01, 9.89847441596477862e-01, 9.89716166580352552e-01,
+    9.89577622862819806e-01, 9.89431387641846793e-01, 9.89276997460942220e-01,
+    9.89113943673095242e-01, 9.88941667252041801e-01, 9.88759552841243727e-01,
+    9.88566921909159735e-01, 9.88363024852603411e-01, 9.88147031856945746e-01,
+    9.87918022280905084e-01, 9.87674972282530983e-01, 9.87416740338836418e-01,
+    9.87142050230599533e-01, 9.86849470961088659e-01, 9.86537392946165492e-01,
+    9.86203999644238993e-01, 9.85847233575538939e-01, 9.85464755394089953e-01,
+    9.85053894298990707e-01, 9.84611587571034730e-01, 9.84134306349457311e-01,
+    9.83617963854474642e-01, 9.83057801016833710e-01, 9.82448242752572809e-01,
+    9.81782715706112641e-01, 9.81053414854475614e-01, 9.80251001422766666e-01,
+    9.79364207327450553e-01, 9.78379310596331209e-01, 9.77279429885292150e-01,
+    9.76043560938631538e-01, 9.74645237830076394e-01, 9.73050636875224528e-01,
+    9.71215832686298519e-01, 9.69082729050209202e-01, 9.66572853785381825e-01,
+    9.63577586311879508e-01, 9.59942176565900973e-01, 9.55438418828696179e-01,
+    9.49715347880916272e-01, 9.42204206015937795e-01, 9.31919326748950616e-01,
+    9.16992797071693122e-01, 8.93410519724597618e-01, 8.50716549379434417e-01,
+    7.50461021388994287e-01, 0.00000000000000000e+00
+};
+
+// clang-format on
+
+/* The polynomial of the xoshiro256 `jump()` function. */
+static const dzU64 prngJumpTable[4] = { UINT64_C(0x180EC6D33CFD0ABA),
+                                        UINT64_C(0xD5A61266F0C9392C),
+                                        UINT64_C(0xA9582618E03FC9AA),
+                                        UINT64_C(0x39ABDC4529B1661C) };
+
+/* The polynomial of the xoshiro256 `long_jump()` function. */
+static const dzU64 prngLongJumpTable[4] = { UINT64_C(0x76E15D3EFEFDCBBF),
+                                            UINT64_C(0xC5004E441C522FB3),
+                                            UINT64_C(0x77710069854EE241),
+                                            UINT64_C(0x39109BB02ACBE635) };
 
 /* Private Variables ======================================================> */
 
 /* NOTE: Deterministic behavior for research purposes? */
-static dzU64 prngStates[4] = { 0x2025, 0x0926, 0x2116, 0x1200 };
+static const dzRng initialRng = {
+    .states = { 0x2025, 0x0926, 0x2116, 0x1200 }
+};
+
+/* The number of threads that have used their default generators. */
+static dzU32 defaultRngCount = 0U;
+
+/* The default generator of the calling thread. */
+static DZ_UTILS_THREAD_LOCAL dzRng defaultRng;
+
+/* Whether the default generator of the calling thread is initialized. */
+static DZ_UTILS_THREAD_LOCAL bool defaultRngInitialized = false;
 
 /* Private Function Prototypes ============================================> */
 
-/* Returns the next pseudo-random number from the xoshiro256+ generator. */
-DZ_API_STATIC_INLINE dzU64 dzUtilsXoshiroPlus(void);
+/* Returns the value of `x` with its bits thoroughly mixed. */
+DZ_API_STATIC_INLINE dzU64 dzUtilsMix64(dzU64 x);
+
+/* Returns `rng`, or the generator of the calling thread if `NULL`. */
+DZ_API_STATIC_INLINE dzRng *dzUtilsGetRng(dzRng *rng);
+
+/* Advances `rng` with the given jump polynomial. */
+static void dzUtilsRngJumpWith(dzRng *rng, const dzU64 *jumpTable);
 
 /* Returns a pseudo-random number from an uniform distribution. */
-DZ_API_STATIC_INLINE dzF64 dzUtilsUniform(void);
+DZ_API_STATIC_INLINE dzF64 dzUtilsRngUniform(dzRng *rng);
+
+/* 
+    Returns a pseudo-random number from the standard normal distribution, 
+    using the Ziggurat method.
+*/
+DZ_API_STATIC_INLINE dzF64 dzUtilsRngZiggurat(dzRng *rng);
+
+/* 
+    Draws a random point in a random layer of the Ziggurat, 
+    and returns its horizontal position relative to the right edge.
+*/
+DZ_API_STATIC_INLINE dzF64 dzUtilsRngZigguratDraw(dzRng *rng,
+                                                  dzU64 *layerIndex);
+
+/* 
+    Returns a pseudo-random number from the standard normal distribution, 
+    starting from a point outside the core of the Ziggurat.
+*/
+static dzF64 dzUtilsRngZigguratSlow(dzRng *rng, dzU64 layerIndex, dzF64 u);
+
+/* Returns the next pseudo-random number from the xoshiro256+ generator. */
+DZ_API_STATIC_INLINE dzU64 dzUtilsXoshiroPlus(dzRng *rng);
 
 /* Public Functions =======================================================> */
 
 /* Returns a pseudo-random number from a Gaussian distribution. */
 dzF64 dzUtilsGaussian(dzF64 mu, dzF64 sigma) {
-    /* 
-        NOTE: Marsaglia's polar method, with pseudo-random numbers 
-              from the xoshiro256++ generator.
-    */
+    return dzUtilsRngGaussian(NULL, mu, sigma);
+}
+
+/* Returns the 64-bit hash value of `src.ptr`. */
+dzU64 dzUtilsHash64(dzByteArray src) {
+    dzU64 result = UINT64_C(0x9E3779B97F4A7C15) ^ (dzU64) src.size;
 
-    static dzBool hasNextValue = false;
+    if (src.ptr == NULL) return dzUtilsMix64(result);
 
-    static dzF64 nextValue = 0.0;
+    /* 
+        NOTE: Consumes 8 bytes at a time, so that hashing a page 
+              costs about as much as copying it
+    */
 
-    if (hasNextValue) {
-        hasNextValue = !hasNextValue;
+    dzUSize offset = 0U;
 
-        return mu + (nextValue * sigma);
-    } else {
-        dzF64 x, y, r;
+    for (; (offset + sizeof(dzU64)) <= src.size; offset += sizeof(dzU64)) {
+        dzU64 word;
 
-        do {
-            x = (2.0 * dzUtilsUniform()) - 1.0;
-            y = (2.0 * dzUtilsUniform()) - 1.0;
+        (void) memcpy(&word, src.ptr + offset, sizeof word);
 
-            r = x * x + y * y;
-        } while (r >= 1.0 || r == 0.0);
+        result ^= word * UINT64_C(0x87C37B91114253D5);
+        result = BITWISE_ROTATE_LEFT_U64(result, 31)
+                 * UINT64_C(0x4CF5AD432745937F);
+    }
 
-        r = sqrt((-2.0 * log(r)) / r);
+    if (offset < src.size) {
+        dzU64 word = 0U;
 
-        nextValue = y * r, hasNextValue = !hasNextValue;
+        (void) memcpy(&word, src.ptr + offset, src.size - offset);
 
-        return mu + ((x * r) * sigma);
+        result ^= word * UINT64_C(0x87C37B91114253D5);
     }
+
+    return dzUtilsMix64(result);
 }
 
 /* Returns a pseudo-random unsigned 64-bit integer. */
 dzU64 dzUtilsRand(void) {
-    return dzUtilsXoshiroPlus();
+    return dzUtilsRngNext(NULL);
 }
 
 /* 
@@ -97,9 +271,7 @@ dzU64 dzUtilsRand(void) {
     in the given (inclusive) range. 
 */
 dzU64 dzUtilsRandRange(dzU64 min, dzU64 max) {
-    return (min < max)
-               ? (min + (dzU64) ((dzF64) (max - min + 1) * dzUtilsUniform()))
-               : (max + (dzU64) ((dzF64) (min - max + 1) * dzUtilsUniform()));
+    return dzUtilsRngRange(NULL, min, max);
 }
 
 /* 
@@ -107,14 +279,346 @@ dzU64 dzUtilsRandRange(dzU64 min, dzU64 max) {
     in the given (exclusive) range. 
 */
 dzF64 dzUtilsRandRangeF64(dzF64 min, dzF64 max) {
-    return (min < max) ? (min + ((max - min) * dzUtilsUniform()))
-                       : (max + ((min - max) * dzUtilsUniform()));
+    return dzUtilsRngRangeF64(NULL, min, max);
+}
+
+/* Seeds the pseudo-random number generator of the calling thread. */
+void dzUtilsSetSeed(dzU64 seed) {
+    dzUtilsRngInit(NULL, seed);
+}
+
+/* ========================================================================> */
+
+/* 
+    Returns a pseudo-random number from a Gaussian distribution, 
+    drawn from `rng` (or the generator of the calling thread if `NULL`).
+*/
+dzF64 dzUtilsRngGaussian(dzRng *rng, dzF64 mu, dzF64 sigma) {
+    return mu + (sigma * dzUtilsRngZiggurat(dzUtilsGetRng(rng)));
+}
+
+/* 
+    Fills `dst` with `count` pseudo-random numbers from a Gaussian 
+    distribution, drawn from `rng` (or the generator of the calling 
+    thread if `NULL`).
+*/
+void dzUtilsRngGaussianFill(dzRng *rng,
+                            dzF64 *dst,
+                            dzUSize count,
+                            dzF64 mu,
+                            dzF64 sigma) {
+    if (dst == NULL) return;
+
+    rng = dzUtilsGetRng(rng);
+
+    for (dzUSize i = 0U; i < count; i++)
+        dst[i] = dzUtilsRngZiggurat(rng);
+
+    // NOTE: Kept as a separate pass, so that the compiler can vectorize it
+    for (dzUSize i = 0U; i < count; i++)
+        dst[i] = mu + (sigma * dst[i]);
+}
+
+/* 
+    Seeds `rng` (or the generator of the calling thread if `NULL`) 
+    with the given `seed`.
+*/
+void dzUtilsRngInit(dzRng *rng, dzU64 seed) {
+    rng = dzUtilsGetRng(rng);
+
+    // NOTE: Expands `seed` into the generator state with SplitMix64
+    for (int i = 0; i < 4; i++) {
+        seed += UINT64_C(0x9E3779B97F4A7C15);
+
+        rng->states[i] = dzUtilsMix64(seed);
+    }
+}
+
+/* 
+    Advances `rng` by 2^128 steps, which can be used to generate 
+    2^128 non-overlapping streams for parallel computations.
+*/
+void dzUtilsRngJump(dzRng *rng) {
+    dzUtilsRngJumpWith(dzUtilsGetRng(rng), prngJumpTable);
+}
+
+/* 
+    Advances `rng` by 2^192 steps, which can be used to generate 
+    2^64 starting points, each of them with 2^64 streams.
+*/
+void dzUtilsRngLongJump(dzRng *rng) {
+    dzUtilsRngJumpWith(dzUtilsGetRng(rng), prngLongJumpTable);
+}
+
+/* 
+    Returns a pseudo-random unsigned 64-bit integer, 
+    drawn from `rng` (or the generator of the calling thread if `NULL`).
+*/
+dzU64 dzUtilsRngNext(dzRng *rng) {
+    return dzUtilsXoshiroPlus(dzUtilsGetRng(rng));
+}
+
+/* 
+    Returns a pseudo-random unsigned 64-bit integer in the given 
+    (inclusive) range, drawn from `rng` (or the generator of 
+    the calling thread if `NULL`).
+*/
+dzU64 dzUtilsRngRange(dzRng *rng, dzU64 min, dzU64 max) {
+    rng = dzUtilsGetRng(rng);
+
+    return (min < max)
+               ? (min
+                  + (dzU64) ((dzF64) (max - min + 1) * dzUtilsRngUniform(rng)))
+               : (max
+                  + (dzU64) ((dzF64) (min - max + 1)
+                             * dzUtilsRngUniform(rng)));
+}
+
+/* 
+    Returns a pseudo-random double-precision floating-point number 
+    in the given (exclusive) range, drawn from `rng` (or the generator 
+    of the calling thread if `NULL`).
+*/
+dzF64 dzUtilsRngRangeF64(dzRng *rng, dzF64 min, dzF64 max) {
+    rng = dzUtilsGetRng(rng);
+
+    return (min < max) ? (min + ((max - min) * dzUtilsRngUniform(rng)))
+                       : (max + ((min - max) * dzUtilsRngUniform(rng)));
+}
+
+/* ========================================================================> */
+
+/* Returns the number of bits set in the first `bitCount` bits of `bitmap`. */
+dzU64 dzUtilsBitmapCount(const dzU64 *bitmap, dzU64 bitCount) {
+    if (bitmap == NULL) return 0U;
+
+    dzU64 result = 0U, wordCount = bitCount >> 6;
+
+    for (dzU64 i = 0U; i < wordCount; i++)
+        result += dzUtilsPopCount64(bitmap[i]);
+
+    if ((bitCount & 63U) != 0U) {
+        dzU64 tailMask = (UINT64_C(1) << (bitCount & 63U)) - 1U;
+
+        result += dzUtilsPopCount64(bitmap[wordCount] & tailMask);
+    }
+
+    return result;
+}
+
+/* Sets (or clears) all of the first `bitCount` bits of `bitmap`. */
+void dzUtilsBitmapFill(dzU64 *bitmap, dzU64 bitCount, dzBool value) {
+    if (bitmap == NULL) return;
+
+    dzU64 wordCount = dzUtilsBitmapGetWordCount(bitCount);
+
+    (void) memset(bitmap, value ? 0xFF : 0x00, wordCount * sizeof *bitmap);
+
+    // NOTE: Padding bits are always kept cleared
+    if (value && (bitCount & 63U) != 0U)
+        bitmap[wordCount - 1U] = (UINT64_C(1) << (bitCount & 63U)) - 1U;
+}
+
+/* 
+    Returns the index of the first bit set in `bitmap` at or after 
+    `startIndex`, or `UINT64_MAX` if there is no such bit.
+*/
+dzU64 dzUtilsBitmapFindNext(const dzU64 *bitmap,
+                            dzU64 bitCount,
+                            dzU64 startIndex) {
+    if (bitmap == NULL || startIndex >= bitCount) return UINT64_MAX;
+
+    dzU64 wordCount = dzUtilsBitmapGetWordCount(bitCount);
+
+    for (dzU64 i = (startIndex >> 6); i < wordCount; i++) {
+        dzU64 word = bitmap[i];
+
+        // NOTE: Skips the bits before `startIndex` in the first word
+        if (i == (startIndex >> 6)) word &= UINT64_MAX << (startIndex & 63U);
+
+        if (word == 0U) continue;
+
+        dzU64 result = (i << 6) + dzUtilsCountTrailingZeros64(word);
+
+        return (result < bitCount) ? result : UINT64_MAX;
+    }
+
+    return UINT64_MAX;
+}
+
+/* ========================================================================> */
+
+/* 
+    Copies `size` bytes from `src->ptr` to `dst`, 
+    and advances `src->offset`.
+*/
+dzBool dzUtilsReadStream(dzByteStream *src, void *dst, dzUSize size) {
+    if (src == NULL || src->ptr == NULL || (dst == NULL && size > 0U)
+        || size > src->size || src->offset > src->size - size)
+        return false;
+
+    if (size > 0U) (void) memcpy(dst, src->ptr + src->offset, size);
+
+    src->offset += size;
+
+    return true;
+}
+
+/* 
+    Copies `size` bytes from `src` to `dst->ptr`, 
+    and advances `dst->offset`.
+*/
+dzBool dzUtilsWriteStream(dzByteStream *dst, const void *src, dzUSize size) {
+    if (dst == NULL || dst->ptr == NULL || (src == NULL && size > 0U)
+        || size > dst->size || dst->offset > dst->size - size)
+        return false;
+
+    if (size > 0U) (void) memcpy(dst->ptr + dst->offset, src, size);
+
+    dst->offset += size;
+
+    return true;
 }
 
 /* Private Functions ======================================================> */
 
+/* Returns the value of `x` with its bits thoroughly mixed. */
+DZ_API_STATIC_INLINE dzU64 dzUtilsMix64(dzU64 x) {
+    // NOTE: The finalizer of the SplitMix64 generator
+    x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+
+    return x ^ (x >> 31);
+}
+
+/* Returns `rng`, or the generator of the calling thread if `NULL`. */
+DZ_API_STATIC_INLINE dzRng *dzUtilsGetRng(dzRng *rng) {
+    if (rng != NULL) return rng;
+
+    if (!defaultRngInitialized) {
+        dzU32 threadIndex = __atomic_fetch_add(&defaultRngCount,
+                                               1U,
+                                               __ATOMIC_RELAXED);
+
+        defaultRng = initialRng;
+
+        /*
+            NOTE: Each thread starts its own non-overlapping stream, 
+                  while the first one keeps the fixed initial state
+        */
+        for (dzU32 i = 0U; i < threadIndex; i++)
+            dzUtilsRngJumpWith(&defaultRng, prngJumpTable);
+
+        defaultRngInitialized = true;
+    }
+
+    return &defaultRng;
+}
+
+/* Advances `rng` with the given jump polynomial. */
+static void dzUtilsRngJumpWith(dzRng *rng, const dzU64 *jumpTable) {
+    dzU64 newStates[4] = { 0U, 0U, 0U, 0U };
+
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 64; j++) {
+            if (jumpTable[i] & (UINT64_C(1) << j))
+                for (int k = 0; k < 4; k++)
+                    newStates[k] ^= rng->states[k];
+
+            (void) dzUtilsXoshiroPlus(rng);
+        }
+
+    (void) memcpy(rng->states, newStates, sizeof newStates);
+}
+
+/* Returns a pseudo-random number from an uniform distribution. */
+DZ_API_STATIC_INLINE dzF64 dzUtilsRngUniform(dzRng *rng) {
+    // NOTE: Extract the upper 53 bits, then multiply by 2^(-53)
+    return 1.11022302462515654e-16 * ((dzF64) (dzUtilsXoshiroPlus(rng) >> 11));
+}
+
+/* 
+    Returns a pseudo-random number from the standard normal distribution, 
+    using the Ziggurat method.
+*/
+DZ_API_STATIC_INLINE dzF64 dzUtilsRngZiggurat(dzRng *rng) {
+    /*
+        NOTE: G. Marsaglia and W. W. Tsang, "The Ziggurat Method for 
+              Generating Random Variables", with the improvements by 
+              J. A. Doornik (2005). About 98.8% of all draws take 
+              the fast path below, without any calls to `exp()`.
+    */
+
+    dzU64 layerIndex = 0U;
+
+    dzF64 u = dzUtilsRngZigguratDraw(rng, &layerIndex);
+
+    if (fabs(u) < zigguratRatioTable[layerIndex])
+        return u * zigguratEdgeTable[layerIndex];
+
+    return dzUtilsRngZigguratSlow(rng, layerIndex, u);
+}
+
+/* 
+    Draws a random point in a random layer of the Ziggurat, 
+    and returns its horizontal position relative to the right edge.
+*/
+DZ_API_STATIC_INLINE dzF64 dzUtilsRngZigguratDraw(dzRng *rng,
+                                                  dzU64 *layerIndex) {
+    dzU64 value = dzUtilsXoshiroPlus(rng);
+
+    /*
+        NOTE: The lowest bits of xoshiro256+ are weaker than the others, 
+              so the layer index is taken from the bits 4 to 10, 
+              and the position from the upper 53 bits
+    */
+    *layerIndex = (value >> 4) & (DZ_UTILS_ZIGGURAT_LAYER_COUNT - 1U);
+
+    return (2.0 * (1.11022302462515654e-16 * (dzF64) (value >> 11))) - 1.0;
+}
+
+/* 
+    Returns a pseudo-random number from the standard normal distribution, 
+    starting from a point outside the core of the Ziggurat.
+*/
+static dzF64 dzUtilsRngZigguratSlow(dzRng *rng, dzU64 layerIndex, dzF64 u) {
+    for (;;) {
+        if (fabs(u) < zigguratRatioTable[layerIndex])
+            return u * zigguratEdgeTable[layerIndex];
+
+        if (layerIndex == 0U) {
+            // NOTE: Marsaglia's method for the tail beyond the bottom layer
+            const dzF64 tailStart = DZ_UTILS_ZIGGURAT_TAIL_START;
+
+            dzF64 x, y;
+
+            do {
+                x = log(1.0 - dzUtilsRngUniform(rng)) / tailStart;
+                y = log(1.0 - dzUtilsRngUniform(rng));
+            } while ((-2.0 * y) < (x * x));
+
+            return (u < 0.0) ? (x - tailStart) : (tailStart - x);
+        }
+
+        {
+            dzF64 x = u * zigguratEdgeTable[layerIndex];
+
+            dzF64 x0 = zigguratEdgeTable[layerIndex];
+            dzF64 x1 = zigguratEdgeTable[layerIndex + 1U];
+
+            dzF64 f0 = exp(-0.5 * ((x0 * x0) - (x * x)));
+            dzF64 f1 = exp(-0.5 * ((x1 * x1) - (x * x)));
+
+            // NOTE: Accepts the points under the curve within the wedge
+            if (f1 + (dzUtilsRngUniform(rng) * (f0 - f1)) < 1.0) return x;
+        }
+
+        u = dzUtilsRngZigguratDraw(rng, &layerIndex);
+    }
+}
+
 /* Returns the next pseudo-random number from the xoshiro256+ generator. */
-DZ_API_STATIC_INLINE dzU64 dzUtilsXoshiroPlus(void) {
+DZ_API_STATIC_INLINE dzU64 dzUtilsXoshiroPlus(dzRng *rng) {
     /*
         NOTE: The original code was written in 2019
               by David Blackman and Sebastiano Vigna.
@@ -122,26 +626,22 @@ DZ_API_STATIC_INLINE dzU64 dzUtilsXoshiroPlus(void) {
               (https://prng.di.unimi.it)
     */
 
-    dzU64 result = prngStates[0] + prngStates[3];
+    dzU64 *states = rng->states;
+
+    dzU64 result = states[0] + states[3];
 
     {
-        const dzU64 tempValue = prngStates[1] << 17;
+        const dzU64 tempValue = states[1] << 17;
 
-        prngStates[2] ^= prngStates[0];
-        prngStates[3] ^= prngStates[1];
-        prngStates[1] ^= prngStates[2];
-        prngStates[0] ^= prngStates[3];
+        states[2] ^= states[0];
+        states[3] ^= states[1];
+        states[1] ^= states[2];
+        states[0] ^= states[3];
 
-        prngStates[2] ^= tempValue;
+        states[2] ^= tempValue;
 
-        prngStates[3] = BITWISE_ROTATE_LEFT_U64(prngStates[3], 45);
+        states[3] = BITWISE_ROTATE_LEFT_U64(states[3], 45);
     }
 
     return result;
 }
-
-/* Returns a pseudo-random number from an uniform distribution. */
-DZ_API_STATIC_INLINE dzF64 dzUtilsUniform(void) {
-    // NOTE: Extract the upper 53 bits, then multiply by 2^(-53)
-    return 1.11022302462515654e-16 * ((dzF64) (dzUtilsXoshiroPlus() >> 11));
-}
@@ -27,8 +27,13 @@
 
 /* Public Function Prototypes =============================================> */
 
+SUITE_EXTERN(dzTestChannel);
 SUITE_EXTERN(dzTestChip);
 SUITE_EXTERN(dzTestDie);
+SUITE_EXTERN(dzTestFTL);
+SUITE_EXTERN(dzTestQueue);
+SUITE_EXTERN(dzTestSim);
+SUITE_EXTERN(dzTestSSD);
 SUITE_EXTERN(dzTestUtils);
 
 /* Public Functions =======================================================> */
@@ -40,8 +45,13 @@ GREATEST_MAIN_DEFS();
 int main(int argc, char *argv[]) {
     GREATEST_MAIN_BEGIN();
 
+    RUN_SUITE(dzTestChannel);
     RUN_SUITE(dzTestChip);
     RUN_SUITE(dzTestDie);
+    RUN_SUITE(dzTestFTL);
+    RUN_SUITE(dzTestQueue);
+    RUN_SUITE(dzTestSim);
+    RUN_SUITE(dzTestSSD);
     RUN_SUITE(dzTestUtils);
 
     GREATEST_MAIN_END();
@@ -0,0 +1,197 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include "greatest.h"
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// clang-format off
+
+#define DZ_TEST_CHIP_COUNT          2U
+#define DZ_TEST_DIE_COUNT           2U
+#define DZ_TEST_PAGE_SIZE_IN_BYTES  2048U
+
+// clang-format on
+
+/* Constants ==============================================================> */
+
+// clang-format off
+
+static dzDieConfig dieConfig = {
+    .cellType = DZ_CELL_TYPE_MLC,
+    .badBlockRatio = 0.0,
+    .planeCountPerDie = 2U,
+    .blockCountPerPlane = 64U,
+    .pageCountPerBlock = 64U,
+    .pageSizeInBytes = DZ_TEST_PAGE_SIZE_IN_BYTES
+};
+
+static dzChipConfig chipConfig = {
+    .dieConfig = &dieConfig,
+    .seed = 0x5EEDU,
+    .dieCount = DZ_TEST_DIE_COUNT,
+    .threadCount = 1U
+};
+
+static const dzChannelConfig channelConfig = {
+    .chipConfig = &chipConfig,
+    .channelId = 0U,
+    .chipCount = DZ_TEST_CHIP_COUNT,
+    .timingMode = 5U
+};
+
+// clang-format on
+
+/* Private Variables ======================================================> */
+
+static dzChannel *channel = NULL;
+
+/* Private Function Prototypes ============================================> */
+
+static void dzTestSetupCb(void *ctx);
+static void dzTestTeardownCb(void *ctx);
+
+TEST dzTestChannelInit(void);
+TEST dzTestChannelBus(void);
+
+/* Public Functions =======================================================> */
+
+SUITE(dzTestChannel) {
+    SET_SETUP(dzTestSetupCb, NULL);
+    SET_TEARDOWN(dzTestTeardownCb, NULL);
+
+    RUN_TEST(dzTestChannelInit);
+    RUN_TEST(dzTestChannelBus);
+}
+
+/* Private Functions ======================================================> */
+
+static void dzTestSetupCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    (void) dzChannelInit(&channel, channelConfig);
+}
+
+static void dzTestTeardownCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    dzChannelDeinit(channel), channel = NULL;
+}
+
+/* ========================================================================> */
+
+TEST dzTestChannelInit(void) {
+    ASSERT_NEQ(NULL, channel);
+
+    ASSERT_EQ(DZ_TEST_CHIP_COUNT, dzChannelGetChipCount(channel));
+
+    ASSERT_EQ(NULL, dzChannelGetChip(channel, DZ_TEST_CHIP_COUNT));
+
+    ASSERT_IN_RANGE(0.05, dzChannelGetBandwidth(channel), 1e-9);
+
+    for (dzU64 i = 0U; i < DZ_TEST_CHIP_COUNT; i++) {
+        dzChip *chip = dzChannelGetChip(channel, i);
+
+        ASSERT_NEQ(NULL, chip);
+
+        ASSERT_EQ(DZ_TEST_DIE_COUNT, dzChipGetDieCount(chip));
+
+        dzDieConfig newDieConfig = dzDieGetConfig(dzChipGetDie(chip, 0U));
+
+        ASSERT_EQ(dzOnfiGetCycleTime(channelConfig.timingMode),
+                  newDieConfig.ioCycleTime);
+    }
+
+    {
+        dzChannelConfig newChannelConfig = channelConfig;
+
+        newChannelConfig.timingMode = 6U;
+
+        dzChannel *newChannel = NULL;
+
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzChannelInit(&newChannel, newChannelConfig));
+    }
+
+    PASS();
+}
+
+TEST dzTestChannelBus(void) {
+    ASSERT_NEQ(NULL, channel);
+
+    dzSim *sim = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzSimInit(&sim, (dzSimConfig) { 0 }));
+
+    dzByte data[DZ_TEST_PAGE_SIZE_IN_BYTES] = { 0x3C };
+
+    dzByteArray buffer = { .ptr = data, .size = sizeof data };
+
+    dzSimOp ops[DZ_TEST_CHIP_COUNT * DZ_TEST_DIE_COUNT];
+
+    // NOTE: One program operation on every die, all issued at once
+    for (dzU64 i = 0U; i < DZ_TEST_CHIP_COUNT * DZ_TEST_DIE_COUNT; i++) {
+        dzDie *die = dzChipGetDie(dzChannelGetChip(channel,
+                                                   i / DZ_TEST_DIE_COUNT),
+                                  i % DZ_TEST_DIE_COUNT);
+
+        dzPBA pba = dzDieGetNextPBA(die, dzDieGetFirstPBA(die));
+
+        ops[i] = (dzSimOp) { .type = DZ_SIM_OP_TYPE_PROGRAM,
+                             .die = die,
+                             .channel = channel,
+                             .ppa = pba,
+                             .buffer = buffer };
+
+        ASSERT_EQ(DZ_RESULT_OK, dzSimSubmitOp(sim, &ops[i], 0U));
+    }
+
+    (void) dzSimRun(sim, UINT64_MAX);
+
+    dzU64 transferTime = dzDieGetPageTransferTime(ops[0].die);
+
+    ASSERT_LT(0U, transferTime);
+
+    for (dzU64 i = 0U; i < DZ_TEST_CHIP_COUNT * DZ_TEST_DIE_COUNT; i++) {
+        ASSERT_EQ(DZ_RESULT_OK, ops[i].result);
+
+        dzU64 latency = (dzU64) ((dzDieGetLastLatency(ops[i].die) * 1e6)
+                                 + 0.5);
+
+        // NOTE: Data transfers are serialized, array operations overlap
+        ASSERT_EQ((i + 1U) * transferTime, ops[i].endTime - latency);
+    }
+
+    dzU64 busyTime = DZ_TEST_CHIP_COUNT * DZ_TEST_DIE_COUNT * transferTime;
+
+    ASSERT_EQ(busyTime, dzChannelGetBusBusyTime(channel));
+    ASSERT_EQ(busyTime, dzChannelGetBusReadyTime(channel));
+
+    ASSERT_IN_RANGE(1.0, dzChannelGetBusUtilization(channel, busyTime), 1e-9);
+
+    dzSimDeinit(sim);
+
+    PASS();
+}
@@ -27,7 +27,7 @@
 
 /* Macros =================================================================> */
 
-// TODO: ...
+#define DZ_TEST_SNAPSHOT_PATH  "ssdeez-tests.snap"
 
 /* Constants ==============================================================> */
 
@@ -61,6 +61,8 @@ static void dzTestSetupCb(void *ctx);
 static void dzTestTeardownCb(void *ctx);
 
 TEST dzTestChipOps(void);
+TEST dzTestChipSnapshot(void);
+TEST dzTestChipParallelInit(void);
 
 /* Public Functions =======================================================> */
 
@@ -69,6 +71,8 @@ SUITE(dzTestChip) {
     SET_TEARDOWN(dzTestTeardownCb, NULL);
 
     RUN_TEST(dzTestChipOps);
+    RUN_TEST(dzTestChipSnapshot);
+    RUN_TEST(dzTestChipParallelInit);
 }
 
 /* Private Functions ======================================================> */
@@ -92,3 +96,115 @@ TEST dzTestChipOps(void) {
 
     PASS();
 }
+
+TEST dzTestChipSnapshot(void) {
+    ASSERT_NEQ(NULL, chip);
+
+    dzDie *die = dzChipGetDie(chip, 1U);
+
+    ASSERT_NEQ(NULL, die);
+
+    const dzByte srcData[] = { 0x5A, 0xA5, 0x5A, 0xA5 };
+
+    dzByteArray srcBuffer = { .ptr = (dzByte *) srcData,
+                              .size = sizeof srcData };
+
+    dzPPA ppa = dzDieGetFirstPPA(die);
+
+    while (dzDieGetPageState(die, ppa) != DZ_PAGE_STATE_FREE)
+        ppa = dzDieGetNextPPA(die, ppa);
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(die, ppa, srcBuffer));
+
+    dzByte dstData[2048];
+
+    dzByteArray dstBuffer = { .ptr = dstData, .size = sizeof dstData };
+
+    for (int i = 0; i < 2; i++) {
+        dzBool withPayload = (i == 0);
+
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzChipSave(chip, DZ_TEST_SNAPSHOT_PATH, withPayload));
+
+        dzChip *newChip = NULL;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzChipLoad(&newChip, DZ_TEST_SNAPSHOT_PATH));
+
+        ASSERT_EQ(dzChipGetDieCount(chip), dzChipGetDieCount(newChip));
+
+        dzDie *newDie = dzChipGetDie(newChip, 1U);
+
+        ASSERT_EQ(dzDieGetTotalProgramCount(die),
+                  dzDieGetTotalProgramCount(newDie));
+
+        ASSERT_EQ(dzDieGetMaxPeCycles(die), dzDieGetMaxPeCycles(newDie));
+
+        for (dzPBA pba = dzDieGetFirstPBA(die);
+             pba.blockId != DZ_BLOCK_INVALID_ID;
+             pba = dzDieGetNextPBA(die, pba))
+            ASSERT_EQ(dzDieGetBlockState(die, pba),
+                      dzDieGetBlockState(newDie, pba));
+
+        ASSERT_EQ(DZ_PAGE_STATE_VALID, dzDieGetPageState(newDie, ppa));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(newDie, ppa, dstBuffer));
+
+        if (withPayload)
+            ASSERT_MEM_EQ(srcBuffer.ptr, dstBuffer.ptr, srcBuffer.size);
+        else
+            ASSERT_EQ((dzByte) 0xFF, dstBuffer.ptr[0]);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadParameterPage(newDie, dstBuffer));
+
+        ASSERT_MEM_EQ("ONFI", dstBuffer.ptr, 4U);
+
+        dzChipDeinit(newChip);
+    }
+
+    ASSERT_EQ(0, remove(DZ_TEST_SNAPSHOT_PATH));
+
+    PASS();
+}
+
+TEST dzTestChipParallelInit(void) {
+    dzChipConfig newChipConfigs[2] = { chipConfig, chipConfig };
+
+    newChipConfigs[0].seed = newChipConfigs[1].seed = 0x5EEDU;
+    newChipConfigs[0].dieCount = newChipConfigs[1].dieCount = 4U;
+
+    newChipConfigs[0].threadCount = 1U;
+    newChipConfigs[1].threadCount = 4U;
+
+    dzChip *newChips[2] = { NULL, NULL };
+
+    for (int i = 0; i < 2; i++)
+        ASSERT_EQ(DZ_RESULT_OK, dzChipInit(&newChips[i], newChipConfigs[i]));
+
+    // NOTE: The caller's die configuration must be left untouched
+    ASSERT_EQ(dieConfig.dieId, chipConfig.dieConfig->dieId);
+
+    for (dzU32 i = 0; i < newChipConfigs[0].dieCount; i++) {
+        dzDie *lhs = dzChipGetDie(newChips[0], i);
+        dzDie *rhs = dzChipGetDie(newChips[1], i);
+
+        ASSERT_NEQ(NULL, lhs);
+        ASSERT_NEQ(NULL, rhs);
+
+        ASSERT_EQ(i, dzDieGetConfig(rhs).dieId);
+
+        ASSERT_EQ(dzDieGetMaxPeCycles(lhs), dzDieGetMaxPeCycles(rhs));
+
+        ASSERT_EQ(dzDieGetMaxReadLatency(lhs), dzDieGetMaxReadLatency(rhs));
+
+        for (dzPBA pba = dzDieGetFirstPBA(lhs);
+             pba.blockId != DZ_BLOCK_INVALID_ID;
+             pba = dzDieGetNextPBA(lhs, pba))
+            ASSERT_EQ(dzDieGetBlockState(lhs, pba),
+                      dzDieGetBlockState(rhs, pba));
+    }
+
+    for (int i = 0; i < 2; i++)
+        dzChipDeinit(newChips[i]);
+
+    PASS();
+}
@@ -27,7 +27,12 @@
 
 /* Macros =================================================================> */
 
-#define DZ_TEST_PAGE_SIZE_IN_BYTES 2048U
+// clang-format off
+
+#define DZ_TEST_IMAGE_PATH          "ssdeez-tests.img"
+#define DZ_TEST_PAGE_SIZE_IN_BYTES  2048U
+
+// clang-format on
 
 /* Constants ==============================================================> */
 
@@ -53,7 +58,17 @@ static void dzTestTeardownCb(void *ctx);
 
 TEST dzTestPageOps(void);
 TEST dzTestBlockOps(void);
+TEST dzTestBlockStateMaps(void);
+TEST dzTestPageInvalidation(void);
 TEST dzTestDieStats(void);
+TEST dzTestDieBuffer(void);
+TEST dzTestDieDataModes(void);
+TEST dzTestDieImage(void);
+TEST dzTestDieClone(void);
+TEST dzTestDieMultiPlane(void);
+TEST dzTestDieBatch(void);
+TEST dzTestDiePageView(void);
+TEST dzTestDieLazyErase(void);
 
 /* Public Functions =======================================================> */
 
@@ -63,7 +78,17 @@ SUITE(dzTestDie) {
 
     RUN_TEST(dzTestPageOps);
     RUN_TEST(dzTestBlockOps);
+    RUN_TEST(dzTestBlockStateMaps);
+    RUN_TEST(dzTestPageInvalidation);
     RUN_TEST(dzTestDieStats);
+    RUN_TEST(dzTestDieBuffer);
+    RUN_TEST(dzTestDieDataModes);
+    RUN_TEST(dzTestDieImage);
+    RUN_TEST(dzTestDieClone);
+    RUN_TEST(dzTestDieMultiPlane);
+    RUN_TEST(dzTestDieBatch);
+    RUN_TEST(dzTestDiePageView);
+    RUN_TEST(dzTestDieLazyErase);
 }
 
 /* Private Functions ======================================================> */
@@ -198,6 +223,152 @@ TEST dzTestBlockOps(void) {
     PASS();
 }
 
+TEST dzTestBlockStateMaps(void) {
+    dzBlockMetadata *blockMetadata = malloc(dzBlockGetMetadataSize());
+
+    dzByte *mapRegion = malloc(dzBlockGetMapRegionSize(96U));
+
+    ASSERT_NEQ(NULL, blockMetadata);
+    ASSERT_NEQ(NULL, mapRegion);
+
+    dzBlockConfig blockConfig = {
+        .physicalBlockAddress = dzDieGetFirstPBA(die),
+        .pageCount = 96U,
+        .cellType = DZ_CELL_TYPE_SLC
+    };
+
+    ASSERT_EQ(DZ_RESULT_OK,
+              dzBlockInitMetadata(blockMetadata, mapRegion, blockConfig));
+
+    ASSERT_EQ(blockConfig.pageCount,
+              dzBlockGetPageCountByState(blockMetadata, DZ_PAGE_STATE_FREE));
+
+    {
+        for (dzU64 i = 0U; i < 10U; i++) {
+            ASSERT_EQ(DZ_RESULT_OK,
+                      dzBlockUpdatePageStateMap(blockMetadata,
+                                                DZ_PAGE_STATE_VALID));
+
+            ASSERT_EQ(DZ_RESULT_OK, dzBlockAdvanceNextPageId(blockMetadata));
+        }
+
+        ASSERT_EQ(DZ_RESULT_OK, dzBlockMarkAsActive(blockMetadata));
+
+        // NOTE: Only the programmed pages should be valid in an active block
+        ASSERT_EQ(10U, dzBlockGetValidPageCount(blockMetadata));
+
+        ASSERT_EQ(DZ_PAGE_STATE_VALID, dzBlockGetPageState(blockMetadata, 9U));
+        ASSERT_EQ(DZ_PAGE_STATE_FREE, dzBlockGetPageState(blockMetadata, 10U));
+
+        ASSERT_EQ(10U,
+                  dzBlockFindNextPageId(blockMetadata,
+                                        DZ_PAGE_STATE_FREE,
+                                        0U));
+
+        ASSERT_EQ(DZ_PAGE_INVALID_ID,
+                  dzBlockFindNextPageId(blockMetadata,
+                                        DZ_PAGE_STATE_VALID,
+                                        10U));
+    }
+
+    {
+        dzF64 eraseLatency = 0.0;
+
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzBlockMarkAsFree(blockMetadata, NULL, &eraseLatency));
+
+        ASSERT_EQ(0U, dzBlockGetValidPageCount(blockMetadata));
+
+        ASSERT_EQ(blockConfig.pageCount,
+                  dzBlockGetPageCountByState(blockMetadata,
+                                             DZ_PAGE_STATE_FREE));
+    }
+
+    free(blockMetadata), free(mapRegion);
+
+    PASS();
+}
+
+TEST dzTestPageInvalidation(void) {
+    dzDieConfig newDieConfig = dieConfig;
+
+    newDieConfig.blockCountPerPlane = 64U;
+    newDieConfig.badBlockRatio = 0.0;
+
+    dzDie *newDie = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&newDie, newDieConfig));
+
+    const dzByte srcData[] = { 0x12, 0x34, 0x56, 0x78 };
+
+    dzByteArray srcBuffer = { .ptr = (dzByte *) srcData,
+                              .size = sizeof srcData };
+
+    dzPBA pba = dzDieGetFirstPBA(newDie);
+
+    // NOTE: Pages that have never been programmed cannot be invalidated
+    ASSERT_EQ(DZ_RESULT_INVALID_STATE, dzDieInvalidatePage(newDie, pba));
+
+    {
+        dzPPA ppa = pba;
+
+        for (dzU64 i = 0U; i < newDieConfig.pageCountPerBlock; i++) {
+            ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(newDie, ppa, srcBuffer));
+
+            ppa = dzDieGetNextPPA(newDie, ppa);
+        }
+
+        ASSERT_EQ(newDieConfig.pageCountPerBlock,
+                  dzDieGetValidPageCount(newDie));
+    }
+
+    {
+        dzPPA ppa = pba;
+
+        for (dzU64 i = 0U; i < 10U; i++) {
+            ASSERT_EQ(DZ_RESULT_OK, dzDieInvalidatePage(newDie, ppa));
+
+            ASSERT_EQ(DZ_PAGE_STATE_INVALID, dzDieGetPageState(newDie, ppa));
+
+            ppa = dzDieGetNextPPA(newDie, ppa);
+        }
+
+        ASSERT_EQ(DZ_RESULT_INVALID_STATE, dzDieInvalidatePage(newDie, pba));
+
+        ASSERT_EQ(newDieConfig.pageCountPerBlock - 10U,
+                  dzDieGetBlockValidPageCount(newDie, pba));
+        ASSERT_EQ(10U, dzDieGetBlockInvalidPageCount(newDie, pba));
+
+        ASSERT_EQ(newDieConfig.pageCountPerBlock - 10U,
+                  dzDieGetValidPageCount(newDie));
+        ASSERT_EQ(10U, dzDieGetInvalidPageCount(newDie));
+    }
+
+    {
+        ASSERT_EQ(DZ_RESULT_OK, dzDieMarkBlockAsVictim(newDie, pba));
+
+        ASSERT_EQ(DZ_BLOCK_STATE_VICTIM, dzDieGetBlockState(newDie, pba));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieEraseBlock(newDie, pba));
+
+        ASSERT_EQ(DZ_BLOCK_STATE_FREE, dzDieGetBlockState(newDie, pba));
+
+        ASSERT_EQ(0U, dzDieGetBlockValidPageCount(newDie, pba));
+        ASSERT_EQ(0U, dzDieGetBlockInvalidPageCount(newDie, pba));
+
+        ASSERT_EQ(0U, dzDieGetValidPageCount(newDie));
+        ASSERT_EQ(0U, dzDieGetInvalidPageCount(newDie));
+
+        // NOTE: Only active blocks can be marked as victims
+        ASSERT_EQ(DZ_RESULT_INVALID_STATE,
+                  dzDieMarkBlockAsVictim(newDie, pba));
+    }
+
+    dzDieDeinit(newDie);
+
+    PASS();
+}
+
 TEST dzTestDieStats(void) {
     ASSERT_NEQ(NULL, die);
 
@@ -261,3 +432,707 @@ TEST dzTestDieStats(void) {
 
     PASS();
 }
+
+TEST dzTestDieBuffer(void) {
+    ASSERT_NEQ(NULL, die);
+
+    // NOTE: Only the ONFI parameter page should be resident at this point
+    ASSERT_EQ(1U, dzDieGetResidentPageCount(die));
+
+    dzPPA ppa = dzDieGetFirstPPA(die);
+
+    while (dzDieGetPageState(die, ppa) != DZ_PAGE_STATE_FREE)
+        ppa = dzDieGetNextPPA(die, ppa);
+
+    dzByte dstData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+    dzByteArray dstBuffer = { .ptr = dstData, .size = sizeof dstData };
+
+    {
+        memset(dstBuffer.ptr, 0x00, dstBuffer.size);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(die, ppa, dstBuffer));
+
+        // NOTE: Reading a page should never allocate its data
+        ASSERT_EQ(1U, dzDieGetResidentPageCount(die));
+
+        for (dzU64 i = 0; i < dstBuffer.size; i++)
+            ASSERT_EQ((dzByte) 0xFF, dstBuffer.ptr[i]);
+    }
+
+    {
+        const dzByte srcData[] = { 0xDE, 0xAD, 0xBE, 0xEF };
+
+        dzByteArray srcBuffer = { .ptr = (dzByte *) srcData,
+                                  .size = sizeof srcData };
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(die, ppa, srcBuffer));
+
+        ASSERT_EQ(2U, dzDieGetResidentPageCount(die));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(die, ppa, dstBuffer));
+
+        ASSERT_MEM_EQ(srcBuffer.ptr, dstBuffer.ptr, srcBuffer.size);
+
+        // NOTE: The rest of the page should remain in the 'erased' state
+        for (dzU64 i = srcBuffer.size; i < dstBuffer.size; i++)
+            ASSERT_EQ((dzByte) 0xFF, dstBuffer.ptr[i]);
+    }
+
+    PASS();
+}
+
+TEST dzTestDieDataModes(void) {
+    dzDieConfig newDieConfig = dieConfig;
+
+    newDieConfig.blockCountPerPlane = 64U;
+    newDieConfig.badBlockRatio = 0.0;
+
+    dzByte dstData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+    dzByteArray dstBuffer = { .ptr = dstData, .size = sizeof dstData };
+
+    {
+        newDieConfig.dataMode = DZ_DIE_DATA_MODE_FINGERPRINT;
+
+        dzDie *newDie = NULL;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&newDie, newDieConfig));
+
+        ASSERT_EQ(0U, dzDieGetResidentPageCount(newDie));
+
+        const dzByte srcData[] = { 0xDE, 0xAD, 0xBE, 0xEF };
+
+        dzByteArray srcBuffer = { .ptr = (dzByte *) srcData,
+                                  .size = sizeof srcData };
+
+        dzPPA ppa = dzDieGetFirstPPA(newDie);
+
+        dzU64 fingerprint = 0U;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(newDie, ppa, srcBuffer));
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieGetPageFingerprint(newDie, ppa, &fingerprint));
+
+        ASSERT_EQ(dzUtilsHash64(srcBuffer), fingerprint);
+
+        // NOTE: No data should be copied in the 'dataless' modes
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieReadPage(newDie, ppa, (dzByteArray) { NULL, 0U }));
+
+        // NOTE: Only fully programmed blocks can be erased at this point
+        for (ppa.pageId = 1U; ppa.pageId < newDieConfig.pageCountPerBlock;
+             ppa.pageId++)
+            ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(newDie, ppa, srcBuffer));
+
+        ppa.pageId = 0U;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieEraseBlock(newDie, ppa));
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieGetPageFingerprint(newDie, ppa, &fingerprint));
+
+        ASSERT_EQ(0U, fingerprint);
+
+        dzDieDeinit(newDie);
+    }
+
+    {
+        newDieConfig.dataMode = DZ_DIE_DATA_MODE_NONE;
+
+        dzDie *newDie = NULL;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&newDie, newDieConfig));
+
+        dzPPA ppa = dzDieGetFirstPPA(newDie);
+
+        dzU64 fingerprint = 0U;
+
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieProgramPage(newDie, ppa, (dzByteArray) { NULL, 0U }));
+        ASSERT_EQ(DZ_RESULT_INVALID_STATE,
+                  dzDieGetPageFingerprint(newDie, ppa, &fingerprint));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadParameterPage(newDie, dstBuffer));
+
+        ASSERT_MEM_EQ("ONFI", dstBuffer.ptr, 4U);
+
+        dzDieDeinit(newDie);
+    }
+
+    PASS();
+}
+
+TEST dzTestDieImage(void) {
+    dzDieConfig newDieConfig = dieConfig;
+
+    newDieConfig.blockCountPerPlane = 64U;
+
+    const dzByte srcData[] = { 0xCA, 0xFE, 0xBA, 0xBE };
+
+    dzByteArray srcBuffer = { .ptr = (dzByte *) srcData,
+                              .size = sizeof srcData };
+
+    dzPPA ppa = dzDieGetFirstPPA(NULL);
+
+    {
+        dzDie *newDie = NULL;
+
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieCreateImage(&newDie, newDieConfig, DZ_TEST_IMAGE_PATH));
+
+        ppa = dzDieGetFirstPPA(newDie);
+
+        while (dzDieGetPageState(newDie, ppa) != DZ_PAGE_STATE_FREE)
+            ppa = dzDieGetNextPPA(newDie, ppa);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(newDie, ppa, srcBuffer));
+
+        dzDieDeinit(newDie);
+    }
+
+    {
+        dzDie *newDie = NULL, *otherDie = NULL;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieOpenImage(&newDie, DZ_TEST_IMAGE_PATH));
+
+        // NOTE: An image should not be opened twice at the same time
+        ASSERT_EQ(DZ_RESULT_INVALID_IMAGE,
+                  dzDieOpenImage(&otherDie, DZ_TEST_IMAGE_PATH));
+
+        ASSERT_EQ(1U, dzDieGetTotalProgramCount(newDie));
+
+        ASSERT_EQ(DZ_PAGE_STATE_VALID, dzDieGetPageState(newDie, ppa));
+
+        dzByte dstData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+        dzByteArray dstBuffer = { .ptr = dstData, .size = sizeof dstData };
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(newDie, ppa, dstBuffer));
+
+        ASSERT_MEM_EQ(srcBuffer.ptr, dstBuffer.ptr, srcBuffer.size);
+
+        for (dzU64 i = srcBuffer.size; i < dstBuffer.size; i++)
+            ASSERT_EQ((dzByte) 0xFF, dstBuffer.ptr[i]);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadParameterPage(newDie, dstBuffer));
+
+        ASSERT_MEM_EQ("ONFI", dstBuffer.ptr, 4U);
+
+        dzDieDeinit(newDie);
+    }
+
+    ASSERT_EQ(0, remove(DZ_TEST_IMAGE_PATH));
+
+    PASS();
+}
+
+TEST dzTestDieClone(void) {
+    dzDieConfig newDieConfig = dieConfig;
+
+    newDieConfig.blockCountPerPlane = 64U;
+    newDieConfig.badBlockRatio = 0.0;
+
+    dzDie *parentDie = NULL, *cloneDie = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&parentDie, newDieConfig));
+
+    const dzByte srcData[] = { 0xFE, 0xED, 0xFA, 0xCE };
+
+    dzByteArray srcBuffer = { .ptr = (dzByte *) srcData,
+                              .size = sizeof srcData };
+
+    dzPBA pba = dzDieGetFirstPBA(parentDie);
+
+    {
+        dzPPA ppa = pba;
+
+        // NOTE: Precondition the parent die by filling the first block
+        for (dzU64 i = 0U; i < newDieConfig.pageCountPerBlock; i++) {
+            ASSERT_EQ(DZ_RESULT_OK,
+                      dzDieProgramPage(parentDie, ppa, srcBuffer));
+
+            ppa = dzDieGetNextPPA(parentDie, ppa);
+        }
+    }
+
+    dzU64 residentPageCount = dzDieGetResidentPageCount(parentDie);
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieClone(&cloneDie, parentDie));
+
+    ASSERT_EQ(residentPageCount, dzDieGetResidentPageCount(cloneDie));
+
+    ASSERT_EQ(dzDieGetTotalProgramCount(parentDie),
+              dzDieGetTotalProgramCount(cloneDie));
+
+    ASSERT_EQ(dzDieGetBlockState(parentDie, pba),
+              dzDieGetBlockState(cloneDie, pba));
+
+    dzByte dstData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+    dzByteArray dstBuffer = { .ptr = dstData, .size = sizeof dstData };
+
+    {
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(cloneDie, pba, dstBuffer));
+
+        ASSERT_MEM_EQ(srcBuffer.ptr, dstBuffer.ptr, srcBuffer.size);
+    }
+
+    {
+        // NOTE: Erasing a block of the clone should not affect the parent
+        ASSERT_EQ(DZ_RESULT_OK, dzDieEraseBlock(cloneDie, pba));
+
+        ASSERT_EQ(DZ_PAGE_STATE_FREE, dzDieGetPageState(cloneDie, pba));
+        ASSERT_EQ(DZ_PAGE_STATE_VALID, dzDieGetPageState(parentDie, pba));
+
+        ASSERT_EQ(residentPageCount - newDieConfig.pageCountPerBlock,
+                  dzDieGetResidentPageCount(cloneDie));
+
+        const dzByte newSrcData[] = { 0xC0, 0xFF, 0xEE };
+
+        dzByteArray newSrcBuffer = { .ptr = (dzByte *) newSrcData,
+                                     .size = sizeof newSrcData };
+
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieProgramPage(cloneDie, pba, newSrcBuffer));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(cloneDie, pba, dstBuffer));
+
+        ASSERT_MEM_EQ(newSrcBuffer.ptr, dstBuffer.ptr, newSrcBuffer.size);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(parentDie, pba, dstBuffer));
+
+        ASSERT_MEM_EQ(srcBuffer.ptr, dstBuffer.ptr, srcBuffer.size);
+    }
+
+    // NOTE: Shared pages must outlive the die that created them
+    dzDieDeinit(parentDie);
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieReadParameterPage(cloneDie, dstBuffer));
+
+    ASSERT_MEM_EQ("ONFI", dstBuffer.ptr, 4U);
+
+    dzDieDeinit(cloneDie);
+
+    PASS();
+}
+
+TEST dzTestDieMultiPlane(void) {
+    dzDieConfig newDieConfig = dieConfig;
+
+    newDieConfig.planeCountPerDie = 4U;
+    newDieConfig.blockCountPerPlane = 16U;
+    newDieConfig.badBlockRatio = 0.0;
+
+    dzDie *newDie = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&newDie, newDieConfig));
+
+    dzByte srcData[4][DZ_TEST_PAGE_SIZE_IN_BYTES];
+    dzByte dstData[4][DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+    dzByteArray srcBuffers[4], dstBuffers[4];
+
+    dzPPA ppas[4];
+
+    for (dzU64 i = 0U; i < 4U; i++) {
+        (void) memset(srcData[i], (dzByte) (0xA0U + i), sizeof srcData[i]);
+
+        srcBuffers[i] = (dzByteArray) { .ptr = srcData[i],
+                                        .size = sizeof srcData[i] };
+        dstBuffers[i] = (dzByteArray) { .ptr = dstData[i],
+                                        .size = sizeof dstData[i] };
+
+        // NOTE: The first block of the die is reserved
+        ppas[i] = (dzPPA) { .planeId = i, .blockId = 1U, .pageId = 0U };
+    }
+
+    {
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzDieProgramMultiPlane(newDie, ppas, srcBuffers, 0U));
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzDieProgramMultiPlane(newDie, ppas, srcBuffers, 5U));
+
+        dzPPA badPPAs[2] = { ppas[0], ppas[0] };
+
+        // NOTE: At most one block per plane
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzDieProgramMultiPlane(newDie, badPPAs, srcBuffers, 2U));
+
+        badPPAs[1] = ppas[1], badPPAs[1].pageId = 1U;
+
+        // NOTE: The same page offset in every plane
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzDieReadMultiPlane(newDie, badPPAs, dstBuffers, 2U));
+
+        ASSERT_EQ(0U, dzDieGetTotalReadCount(newDie));
+
+        srcBuffers[3].size = 0U;
+
+        // NOTE: Every source buffer is checked before any plane is written
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzDieProgramMultiPlane(newDie, ppas, srcBuffers, 4U));
+
+        ASSERT_EQ(0U, dzDieGetTotalProgramCount(newDie));
+        ASSERT_EQ(DZ_PAGE_STATE_FREE, dzDieGetPageState(newDie, ppas[0]));
+
+        srcBuffers[3].size = sizeof srcData[3];
+    }
+
+    for (dzU64 i = 0U; i < newDieConfig.pageCountPerBlock; i++) {
+        for (dzU64 j = 0U; j < 4U; j++)
+            ppas[j].pageId = i;
+
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieProgramMultiPlane(newDie, ppas, srcBuffers, 4U));
+
+        ASSERT_LT(0.0, dzDieGetLastLatency(newDie));
+        ASSERT_GTE(dzDieGetMaxProgramLatency(newDie),
+                   dzDieGetLastLatency(newDie));
+    }
+
+    ASSERT_EQ(4U * newDieConfig.pageCountPerBlock,
+              dzDieGetTotalProgramCount(newDie));
+
+    {
+        // NOTE: Rejected commands must not change the state of any plane
+        for (dzU64 j = 0U; j < 4U; j++)
+            ppas[j].pageId = 0U;
+
+        ppas[3].blockId = 2U;
+
+        ASSERT_EQ(DZ_RESULT_ALREADY_VALID,
+                  dzDieProgramMultiPlane(newDie, ppas, srcBuffers, 4U));
+
+        ASSERT_EQ(DZ_PAGE_STATE_FREE, dzDieGetPageState(newDie, ppas[3]));
+
+        ppas[3].blockId = 1U;
+    }
+
+    {
+        dzU64 totalReadCount = dzDieGetTotalReadCount(newDie);
+
+        dstBuffers[3].size = 0U;
+
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzDieReadMultiPlane(newDie, ppas, dstBuffers, 4U));
+
+        ASSERT_EQ(totalReadCount, dzDieGetTotalReadCount(newDie));
+
+        dstBuffers[3].size = sizeof dstData[3];
+
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieReadMultiPlane(newDie, ppas, dstBuffers, 4U));
+
+        for (dzU64 j = 0U; j < 4U; j++)
+            ASSERT_MEM_EQ(srcData[j], dstData[j], sizeof srcData[j]);
+    }
+
+    {
+        ppas[3].blockId = 2U;
+
+        ASSERT_EQ(DZ_RESULT_ALREADY_FREE,
+                  dzDieEraseMultiPlane(newDie, ppas, 4U));
+
+        ASSERT_EQ(0U, dzDieGetTotalEraseCount(newDie));
+
+        ppas[3].blockId = 1U;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieEraseMultiPlane(newDie, ppas, 4U));
+
+        ASSERT_EQ(4U, dzDieGetTotalEraseCount(newDie));
+
+        for (dzU64 j = 0U; j < 4U; j++)
+            ASSERT_EQ(DZ_BLOCK_STATE_FREE,
+                      dzDieGetBlockState(newDie, ppas[j]));
+    }
+
+    dzDieDeinit(newDie);
+
+    PASS();
+}
+
+TEST dzTestDieBatch(void) {
+    dzDieConfig newDieConfig = dieConfig;
+
+    newDieConfig.blockCountPerPlane = 16U;
+    newDieConfig.badBlockRatio = 0.0;
+
+    dzDie *newDie = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&newDie, newDieConfig));
+
+    dzByte srcData[6][DZ_TEST_PAGE_SIZE_IN_BYTES];
+    dzByte dstData[6][DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+    dzByteArray srcBuffers[6], dstBuffers[6];
+
+    dzResult results[6];
+
+    // NOTE: The first block of the die is reserved
+    dzPPA ppas[6] = { { .blockId = 1U, .pageId = 0U },
+                      { .blockId = 1U, .pageId = 1U },
+                      { .blockId = 1U, .pageId = 2U },
+                      { .blockId = 1U, .pageId = 4U },
+                      { .blockId = 1U, .pageId = 3U },
+                      { .blockId = 2U, .pageId = 0U } };
+
+    for (dzU64 i = 0U; i < 6U; i++) {
+        (void) memset(srcData[i], (dzByte) (0xB0U + i), sizeof srcData[i]);
+
+        srcBuffers[i] = (dzByteArray) { .ptr = srcData[i],
+                                        .size = sizeof srcData[i] };
+        dstBuffers[i] = (dzByteArray) { .ptr = dstData[i],
+                                        .size = sizeof dstData[i] };
+    }
+
+    {
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzDieProgramPages(newDie, ppas, srcBuffers, NULL, 6U));
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieProgramPages(newDie, ppas, srcBuffers, results, 0U));
+    }
+
+    {
+        // NOTE: Each page is programmed in order, even within a run
+        ASSERT_EQ(DZ_RESULT_INVALID_SEQUENCE,
+                  dzDieProgramPages(newDie, ppas, srcBuffers, results, 6U));
+
+        ASSERT_EQ(DZ_RESULT_OK, results[0]);
+        ASSERT_EQ(DZ_RESULT_OK, results[1]);
+        ASSERT_EQ(DZ_RESULT_OK, results[2]);
+        ASSERT_EQ(DZ_RESULT_INVALID_SEQUENCE, results[3]);
+        ASSERT_EQ(DZ_RESULT_OK, results[4]);
+        ASSERT_EQ(DZ_RESULT_OK, results[5]);
+
+        // NOTE: A rejected page is left free, and is not counted
+        ASSERT_EQ(5U, dzDieGetTotalProgramCount(newDie));
+        ASSERT_EQ(DZ_PAGE_STATE_FREE, dzDieGetPageState(newDie, ppas[3]));
+
+        ASSERT_EQ(4U, dzDieGetBlockValidPageCount(newDie, ppas[0]));
+        ASSERT_EQ(1U, dzDieGetBlockValidPageCount(newDie, ppas[5]));
+
+        ASSERT_EQ(DZ_BLOCK_STATE_ACTIVE, dzDieGetBlockState(newDie, ppas[0]));
+        ASSERT_EQ(DZ_BLOCK_STATE_ACTIVE, dzDieGetBlockState(newDie, ppas[5]));
+    }
+
+    {
+        // NOTE: Single-page calls follow the same rules as batches
+        dzPPA ppa = { .blockId = 1U, .pageId = 5U };
+
+        ASSERT_EQ(DZ_RESULT_INVALID_SEQUENCE,
+                  dzDieProgramPage(newDie, ppa, srcBuffers[0]));
+
+        ASSERT_EQ(DZ_PAGE_STATE_FREE, dzDieGetPageState(newDie, ppa));
+
+        // NOTE: A page that is not valid cannot be invalidated
+        ASSERT_EQ(DZ_RESULT_INVALID_STATE, dzDieInvalidatePage(newDie, ppa));
+        ASSERT_EQ(DZ_PAGE_STATE_FREE, dzDieGetPageState(newDie, ppa));
+
+        ppa.pageId = 0U;
+
+        ASSERT_EQ(DZ_RESULT_ALREADY_VALID,
+                  dzDieProgramPage(newDie, ppa, srcBuffers[0]));
+    }
+
+    {
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieReadPages(newDie, ppas, dstBuffers, results, 6U));
+
+        ASSERT_EQ(6U, dzDieGetTotalReadCount(newDie));
+
+        for (dzU64 i = 0U; i < 6U; i++)
+            if (i != 3U)
+                ASSERT_MEM_EQ(srcData[i], dstData[i], sizeof srcData[i]);
+    }
+
+    {
+        dzPPA blockPPAs[64];
+
+        dzByteArray blockSrcBuffers[64];
+
+        dzResult blockResults[64];
+
+        for (dzU64 i = 0U; i < newDieConfig.pageCountPerBlock; i++) {
+            blockPPAs[i] = (dzPPA) { .blockId = 3U, .pageId = i };
+
+            blockSrcBuffers[i] = srcBuffers[i % 6U];
+        }
+
+        // NOTE: A whole block is programmed as a single run
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieProgramPages(newDie,
+                                    blockPPAs,
+                                    blockSrcBuffers,
+                                    blockResults,
+                                    newDieConfig.pageCountPerBlock));
+
+        ASSERT_EQ(DZ_BLOCK_STATE_ACTIVE,
+                  dzDieGetBlockState(newDie, blockPPAs[0]));
+    }
+
+    {
+        dzPBA pbas[2] = { { .blockId = 3U }, { .blockId = 16U } };
+
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzDieEraseBlocks(newDie, pbas, results, 2U));
+
+        ASSERT_EQ(DZ_RESULT_OK, results[0]);
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT, results[1]);
+
+        ASSERT_EQ(DZ_BLOCK_STATE_FREE, dzDieGetBlockState(newDie, pbas[0]));
+    }
+
+    dzDieDeinit(newDie);
+
+    PASS();
+}
+
+TEST dzTestDiePageView(void) {
+    dzDieConfig newDieConfig = dieConfig;
+
+    newDieConfig.blockCountPerPlane = 16U;
+    newDieConfig.badBlockRatio = 0.0;
+
+    dzDie *newDie = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&newDie, newDieConfig));
+
+    dzByte srcData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+    (void) memset(srcData, 0xC3, sizeof srcData);
+
+    dzByteArray srcBuffer = { .ptr = srcData, .size = sizeof srcData };
+
+    // NOTE: The first block of the die is reserved
+    dzPPA ppa = { .blockId = 1U, .pageId = 0U };
+
+    dzDiePageView view = { .ptr = NULL };
+
+    {
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzDieReadPageView(newDie, ppa, NULL));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPageView(newDie, ppa, &view));
+
+        // NOTE: Pages that have never been programmed are in the erased state
+        ASSERT_EQ(DZ_TEST_PAGE_SIZE_IN_BYTES, view.size);
+        ASSERT_EQ(0xFF, view.ptr[view.size - 1U]);
+    }
+
+    for (dzU64 i = 0U; i < newDieConfig.pageCountPerBlock; i++) {
+        ppa.pageId = i;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(newDie, ppa, srcBuffer));
+    }
+
+    {
+        ppa.pageId = 0U;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPageView(newDie, ppa, &view));
+
+        ASSERT(dzDieIsPageViewValid(newDie, view));
+        ASSERT_MEM_EQ(srcData, view.ptr, view.size);
+
+        // NOTE: Views are accounted for exactly like copying reads
+        ASSERT_EQ(2U, dzDieGetTotalReadCount(newDie));
+        ASSERT_LT(0.0, dzDieGetLastLatency(newDie));
+    }
+
+    {
+        ASSERT_EQ(DZ_RESULT_OK, dzDieEraseBlock(newDie, ppa));
+
+        ASSERT_FALSE(dzDieIsPageViewValid(newDie, view));
+    }
+
+    dzDieDeinit(newDie);
+
+    PASS();
+}
+
+TEST dzTestDieLazyErase(void) {
+    dzDieConfig newDieConfig = dieConfig;
+
+    newDieConfig.blockCountPerPlane = 16U;
+    newDieConfig.badBlockRatio = 0.0;
+
+    dzDie *newDie = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&newDie, newDieConfig));
+
+    dzByte srcData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+    dzByte dstData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+    dzByte erasedData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+    (void) memset(srcData, 0x5A, sizeof srcData);
+    (void) memset(erasedData, 0xFF, sizeof erasedData);
+
+    dzByteArray srcBuffer = { .ptr = srcData, .size = sizeof srcData };
+    dzByteArray dstBuffer = { .ptr = dstData, .size = sizeof dstData };
+
+    // NOTE: The first block of the die is reserved
+    dzPPA ppa = { .blockId = 1U, .pageId = 0U };
+
+    for (dzU64 i = 0U; i < newDieConfig.pageCountPerBlock; i++) {
+        ppa.pageId = i;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(newDie, ppa, srcBuffer));
+    }
+
+    dzU64 residentPageCount = dzDieGetResidentPageCount(newDie);
+
+    {
+        ASSERT_EQ(DZ_RESULT_OK, dzDieEraseBlock(newDie, ppa));
+
+        // NOTE: Erased pages stay resident, but are read as erased
+        ASSERT_EQ(residentPageCount, dzDieGetResidentPageCount(newDie));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(newDie, ppa, dstBuffer));
+        ASSERT_MEM_EQ(erasedData, dstData, sizeof dstData);
+    }
+
+    {
+        ppa.pageId = 2U;
+
+        // NOTE: A rejected program never brings back the data before erase
+        ASSERT_EQ(DZ_RESULT_INVALID_SEQUENCE,
+                  dzDieProgramPage(newDie, ppa, srcBuffer));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(newDie, ppa, dstBuffer));
+        ASSERT_MEM_EQ(erasedData, dstData, sizeof dstData);
+    }
+
+    {
+        ppa.pageId = 0U;
+
+        // NOTE: The rest of a partially programmed page stays erased
+        srcBuffer.size = sizeof srcData / 2U;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(newDie, ppa, srcBuffer));
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(newDie, ppa, dstBuffer));
+
+        ASSERT_MEM_EQ(srcData, dstData, srcBuffer.size);
+        ASSERT_MEM_EQ(erasedData + srcBuffer.size,
+                      dstData + srcBuffer.size,
+                      sizeof dstData - srcBuffer.size);
+    }
+
+    {
+        // NOTE: The same holds for a page that was never programmed
+        dzPPA freshPPA = { .blockId = 2U, .pageId = 0U };
+
+        srcBuffer.size = sizeof srcData / 4U;
+
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzDieProgramPage(newDie, freshPPA, srcBuffer));
+        ASSERT_EQ(DZ_RESULT_OK, dzDieReadPage(newDie, freshPPA, dstBuffer));
+
+        ASSERT_MEM_EQ(srcData, dstData, srcBuffer.size);
+        ASSERT_MEM_EQ(erasedData + srcBuffer.size,
+                      dstData + srcBuffer.size,
+                      sizeof dstData - srcBuffer.size);
+    }
+
+    dzDieDeinit(newDie);
+
+    PASS();
+}
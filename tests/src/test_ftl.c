@@ -0,0 +1,246 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include <string.h>
+
+#include "greatest.h"
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// clang-format off
+
+#define DZ_TEST_CHANNEL_COUNT       2U
+#define DZ_TEST_PAGE_SIZE_IN_BYTES  2048U
+
+// clang-format on
+
+/* Constants ==============================================================> */
+
+// clang-format off
+
+static dzDieConfig dieConfig = {
+    .cellType = DZ_CELL_TYPE_SLC,
+    .badBlockRatio = 0.0,
+    .planeCountPerDie = 2U,
+    .blockCountPerPlane = 8U,
+    .pageCountPerBlock = 32U,
+    .pageSizeInBytes = DZ_TEST_PAGE_SIZE_IN_BYTES
+};
+
+static dzChipConfig chipConfig = {
+    .dieConfig = &dieConfig,
+    .seed = 0xC0FFEEU,
+    .dieCount = 1U,
+    .threadCount = 1U
+};
+
+static dzChannelConfig channelConfig = {
+    .chipConfig = &chipConfig,
+    .chipCount = 1U,
+    .timingMode = 4U
+};
+
+static const dzSSDConfig ssdConfig = {
+    .channelConfig = &channelConfig,
+    .channelCount = DZ_TEST_CHANNEL_COUNT
+};
+
+// clang-format on
+
+/* Private Variables ======================================================> */
+
+static dzSSD *ssd = NULL;
+
+static dzFTL *ftl = NULL;
+
+/* Private Function Prototypes ============================================> */
+
+static void dzTestSetupCb(void *ctx);
+static void dzTestTeardownCb(void *ctx);
+
+TEST dzTestFTLInit(void);
+TEST dzTestFTLReadWrite(void);
+TEST dzTestFTLGarbageCollection(void);
+
+/* Public Functions =======================================================> */
+
+SUITE(dzTestFTL) {
+    SET_SETUP(dzTestSetupCb, NULL);
+    SET_TEARDOWN(dzTestTeardownCb, NULL);
+
+    RUN_TEST(dzTestFTLInit);
+    RUN_TEST(dzTestFTLReadWrite);
+    RUN_TEST(dzTestFTLGarbageCollection);
+}
+
+/* Private Functions ======================================================> */
+
+static void dzTestSetupCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    (void) dzSSDInit(&ssd, ssdConfig);
+
+    (void) dzFTLInit(&ftl, ssd, (dzFTLConfig) { .logicalPageCount = 0U });
+}
+
+static void dzTestTeardownCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    dzFTLDeinit(ftl), ftl = NULL;
+
+    dzSSDDeinit(ssd), ssd = NULL;
+}
+
+/* ========================================================================> */
+
+TEST dzTestFTLInit(void) {
+    ASSERT_NEQ(NULL, ftl);
+
+    {
+        dzFTL *newFTL = NULL;
+
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzFTLInit(&newFTL, NULL, (dzFTLConfig) { 0 }));
+
+        dzFTLConfig config = { .logicalPageCount = dzSSDGetPageCount(ssd) };
+
+        // NOTE: Some blocks must be left for garbage collection
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzFTLInit(&newFTL, ssd, config));
+
+        config.logicalPageCount = 64U;
+
+        ASSERT_EQ(DZ_RESULT_OK, dzFTLInit(&newFTL, ssd, config));
+        ASSERT_EQ(64U, dzFTLGetLogicalPageCount(newFTL));
+
+        dzFTLDeinit(newFTL);
+    }
+
+    ASSERT_LT(0U, dzFTLGetLogicalPageCount(ftl));
+    ASSERT_GT(dzSSDGetPageCount(ssd), dzFTLGetLogicalPageCount(ftl));
+
+    ASSERT_EQ(0U, dzFTLGetMappedPageCount(ftl));
+
+    ASSERT_EQ(DZ_PAGE_INVALID_ID, dzFTLGetPPA(ftl, 0U).pageId);
+
+    PASS();
+}
+
+TEST dzTestFTLReadWrite(void) {
+    dzByte srcData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+    dzByte dstData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+    dzByte erasedData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+    (void) memset(erasedData, 0xFF, sizeof erasedData);
+
+    dzByteArray srcBuffer = { .ptr = srcData, .size = sizeof srcData };
+    dzByteArray dstBuffer = { .ptr = dstData, .size = sizeof dstData };
+
+    dzU64 lpnCount = dzFTLGetLogicalPageCount(ftl);
+
+    {
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzFTLWritePage(ftl, lpnCount, srcBuffer));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzFTLReadPage(ftl, 0U, dstBuffer));
+        ASSERT_MEM_EQ(erasedData, dstData, sizeof dstData);
+    }
+
+    for (dzU64 i = 0U; i < lpnCount; i++) {
+        (void) memset(srcData, (dzByte) i, sizeof srcData);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzFTLWritePage(ftl, i, srcBuffer));
+    }
+
+    ASSERT_EQ(lpnCount, dzFTLGetMappedPageCount(ftl));
+    ASSERT_EQ(lpnCount, dzSSDGetValidPageCount(ssd));
+
+    {
+        // NOTE: Consecutive logical pages are striped across channels
+        ASSERT_EQ(0U, dzFTLGetPPA(ftl, 0U).channelId);
+        ASSERT_EQ(1U, dzFTLGetPPA(ftl, 1U).channelId);
+    }
+
+    for (dzU64 i = 0U; i < lpnCount; i++) {
+        (void) memset(srcData, (dzByte) i, sizeof srcData);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzFTLReadPage(ftl, i, dstBuffer));
+        ASSERT_MEM_EQ(srcData, dstData, sizeof dstData);
+    }
+
+    {
+        ASSERT_EQ(DZ_RESULT_OK, dzFTLTrimPage(ftl, 0U));
+        ASSERT_EQ(DZ_RESULT_OK, dzFTLTrimPage(ftl, 0U));
+
+        ASSERT_EQ(lpnCount - 1U, dzFTLGetMappedPageCount(ftl));
+        ASSERT_EQ(1U, dzSSDGetInvalidPageCount(ssd));
+
+        ASSERT_EQ(DZ_RESULT_OK, dzFTLReadPage(ftl, 0U, dstBuffer));
+        ASSERT_MEM_EQ(erasedData, dstData, sizeof dstData);
+    }
+
+    PASS();
+}
+
+TEST dzTestFTLGarbageCollection(void) {
+    dzByte srcData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+    dzByte dstData[DZ_TEST_PAGE_SIZE_IN_BYTES];
+
+    dzByteArray srcBuffer = { .ptr = srcData, .size = sizeof srcData };
+    dzByteArray dstBuffer = { .ptr = dstData, .size = sizeof dstData };
+
+    dzByte lastValues[1024];
+
+    dzU64 lpnCount = dzFTLGetLogicalPageCount(ftl);
+
+    ASSERT_GTE(sizeof lastValues, lpnCount);
+
+    // NOTE: Fill the logical space, then overwrite it in a skewed order
+    for (dzU64 i = 0U; i < 4U * lpnCount; i++) {
+        dzU64 lpn = (i < lpnCount) ? i : ((i * i) + (3U * i)) % lpnCount;
+
+        lastValues[lpn] = (dzByte) i;
+
+        (void) memset(srcData, lastValues[lpn], sizeof srcData);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzFTLWritePage(ftl, lpn, srcBuffer));
+    }
+
+    ASSERT_LT(0U, dzSSDGetTotalEraseCount(ssd));
+    ASSERT_LT(1.0, dzFTLGetWriteAmplification(ftl));
+
+    ASSERT_EQ(lpnCount, dzFTLGetMappedPageCount(ftl));
+    ASSERT_EQ(lpnCount, dzSSDGetValidPageCount(ssd));
+
+    // NOTE: Relocated pages must still hold the latest data
+    for (dzU64 i = 0U; i < lpnCount; i++) {
+        (void) memset(srcData, lastValues[i], sizeof srcData);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzFTLReadPage(ftl, i, dstBuffer));
+        ASSERT_MEM_EQ(srcData, dstData, sizeof dstData);
+    }
+
+    PASS();
+}
@@ -0,0 +1,256 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include <pthread.h>
+
+#include "greatest.h"
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// clang-format off
+
+#define DZ_TEST_OP_COUNT            4096U
+#define DZ_TEST_PAGE_SIZE_IN_BYTES  2048U
+#define DZ_TEST_QUEUE_DEPTH         64U
+
+// clang-format on
+
+/* Typedefs ===============================================================> */
+
+/* A structure that represents the state of a host thread. */
+typedef struct dzTestHost_ {
+    dzQueue *queue;
+    dzSimOp *ops;
+    dzU64 completedCount;
+    dzU64 failedCount;
+} dzTestHost;
+
+/* Constants ==============================================================> */
+
+static const dzDieConfig dieConfig = {
+    .cellType = DZ_CELL_TYPE_SLC,
+    .badBlockRatio = 0.0,
+    .planeCountPerDie = 2U,
+    .blockCountPerPlane = 8U,
+    .pageCountPerBlock = 32U,
+    .pageSizeInBytes = DZ_TEST_PAGE_SIZE_IN_BYTES
+};
+
+/* Private Variables ======================================================> */
+
+static dzQueue *queue = NULL;
+
+/* Private Function Prototypes ============================================> */
+
+static void dzTestSetupCb(void *ctx);
+static void dzTestTeardownCb(void *ctx);
+
+static void *dzTestRunHost(void *ctx);
+
+TEST dzTestQueueInit(void);
+TEST dzTestQueueThreads(void);
+
+/* Public Functions =======================================================> */
+
+SUITE(dzTestQueue) {
+    SET_SETUP(dzTestSetupCb, NULL);
+    SET_TEARDOWN(dzTestTeardownCb, NULL);
+
+    RUN_TEST(dzTestQueueInit);
+    RUN_TEST(dzTestQueueThreads);
+}
+
+/* Private Functions ======================================================> */
+
+static void dzTestSetupCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    (void) dzQueueInit(&queue,
+                       (dzQueueConfig) { .depth = DZ_TEST_QUEUE_DEPTH });
+}
+
+static void dzTestTeardownCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    dzQueueDeinit(queue), queue = NULL;
+}
+
+static void *dzTestRunHost(void *ctx) {
+    dzTestHost *host = ctx;
+
+    dzSimOp *completedOps[DZ_TEST_QUEUE_DEPTH];
+
+    dzU64 submittedCount = 0U;
+
+    while (host->completedCount < DZ_TEST_OP_COUNT) {
+        // NOTE: Submits as many operations as possible, then rings once
+        while (submittedCount < DZ_TEST_OP_COUNT
+               && dzQueueSubmit(host->queue, &(host->ops[submittedCount]))
+                      == DZ_RESULT_OK)
+            submittedCount++;
+
+        dzQueueRingDoorbell(host->queue);
+
+        dzU64 completedCount = dzQueuePollCompletions(host->queue,
+                                                      completedOps,
+                                                      DZ_TEST_QUEUE_DEPTH);
+
+        for (dzU64 i = 0U; i < completedCount; i++)
+            if (completedOps[i]->result != DZ_RESULT_OK) host->failedCount++;
+
+        host->completedCount += completedCount;
+    }
+
+    return NULL;
+}
+
+/* ========================================================================> */
+
+TEST dzTestQueueInit(void) {
+    ASSERT_NEQ(NULL, queue);
+
+    ASSERT_EQ(DZ_TEST_QUEUE_DEPTH, dzQueueGetDepth(queue));
+
+    {
+        dzQueue *newQueue = NULL;
+
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzQueueInit(&newQueue, (dzQueueConfig) { .depth = 0U }));
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzQueueInit(&newQueue, (dzQueueConfig) { .depth = 48U }));
+    }
+
+    dzSim *sim = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzSimInit(&sim, (dzSimConfig) { 0 }));
+
+    dzSimOp ops[DZ_TEST_QUEUE_DEPTH + 1U];
+
+    dzSimOp *completedOps[DZ_TEST_QUEUE_DEPTH];
+
+    // NOTE: Operations without a die are rejected by the simulator
+    for (dzU64 i = 0U; i < DZ_TEST_QUEUE_DEPTH; i++) {
+        ops[i] = (dzSimOp) { .type = DZ_SIM_OP_TYPE_READ };
+
+        ASSERT_EQ(DZ_RESULT_OK, dzQueueSubmit(queue, &ops[i]));
+    }
+
+    ASSERT_EQ(DZ_RESULT_BUSY,
+              dzQueueSubmit(queue, &ops[DZ_TEST_QUEUE_DEPTH]));
+
+    // NOTE: Nothing is visible to the simulator before the doorbell
+    ASSERT_EQ(0U, dzQueueProcess(queue, NULL, sim));
+
+    dzQueueRingDoorbell(queue);
+
+    ASSERT_EQ(DZ_TEST_QUEUE_DEPTH, dzQueueProcess(queue, NULL, sim));
+
+    ASSERT_EQ(DZ_RESULT_OK, dzQueueSubmit(queue, &ops[DZ_TEST_QUEUE_DEPTH]));
+
+    dzQueueRingDoorbell(queue);
+
+    // NOTE: The completion queue has no room for another operation
+    ASSERT_EQ(0U, dzQueueProcess(queue, NULL, sim));
+
+    ASSERT_EQ(DZ_TEST_QUEUE_DEPTH,
+              dzQueuePollCompletions(queue,
+                                     completedOps,
+                                     DZ_TEST_QUEUE_DEPTH));
+
+    for (dzU64 i = 0U; i < DZ_TEST_QUEUE_DEPTH; i++) {
+        ASSERT_EQ(&ops[i], completedOps[i]);
+
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT, completedOps[i]->result);
+    }
+
+    ASSERT_EQ(1U, dzQueueProcess(queue, NULL, sim));
+
+    ASSERT_EQ(1U, dzQueuePollCompletions(queue, completedOps, 1U));
+    ASSERT_EQ(0U, dzQueuePollCompletions(queue, completedOps, 1U));
+
+    dzSimDeinit(sim);
+
+    PASS();
+}
+
+TEST dzTestQueueThreads(void) {
+    ASSERT_NEQ(NULL, queue);
+
+    dzDie *die = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&die, dieConfig));
+
+    dzSim *sim = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzSimInit(&sim, (dzSimConfig) { 0 }));
+
+    dzByte data[DZ_TEST_PAGE_SIZE_IN_BYTES] = { 0x42 };
+
+    dzByteArray buffer = { .ptr = data, .size = sizeof data };
+
+    dzPPA ppa = dzDieGetFirstPPA(die);
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(die, ppa, buffer));
+
+    static dzSimOp ops[DZ_TEST_OP_COUNT];
+
+    for (dzU64 i = 0U; i < DZ_TEST_OP_COUNT; i++)
+        ops[i] = (dzSimOp) { .type = DZ_SIM_OP_TYPE_READ,
+                             .die = die,
+                             .ppa = ppa,
+                             .buffer = buffer };
+
+    dzTestHost host = { .queue = queue, .ops = ops };
+
+    pthread_t thread;
+
+    ASSERT_EQ(0, pthread_create(&thread, NULL, dzTestRunHost, &host));
+
+    dzU64 submittedCount = 0U;
+
+    // NOTE: This thread plays the role of the simulator
+    while (submittedCount < DZ_TEST_OP_COUNT
+           || dzSimGetPendingEventCount(sim) > 0U) {
+        submittedCount += dzQueueProcess(queue, NULL, sim);
+
+        (void) dzSimRun(sim, UINT64_MAX);
+    }
+
+    ASSERT_EQ(0, pthread_join(thread, NULL));
+
+    ASSERT_EQ(DZ_TEST_OP_COUNT, host.completedCount);
+    ASSERT_EQ(0U, host.failedCount);
+
+    ASSERT_EQ(DZ_TEST_OP_COUNT, dzDieGetTotalReadCount(die));
+
+    for (dzU64 i = 1U; i < DZ_TEST_OP_COUNT; i++)
+        ASSERT_LTE(ops[i - 1U].endTime, ops[i].startTime);
+
+    dzSimDeinit(sim);
+
+    dzDieDeinit(die);
+
+    PASS();
+}
@@ -0,0 +1,502 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include "greatest.h"
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// clang-format off
+
+#define DZ_TEST_EVENT_COUNT         1024U
+#define DZ_TEST_OP_COUNT            8U
+#define DZ_TEST_PAGE_SIZE_IN_BYTES  2048U
+
+// clang-format on
+
+/* Typedefs ===============================================================> */
+
+/* A structure that represents the log of all processed events. */
+typedef struct dzTestEventLog_ {
+    dzU64 times[DZ_TEST_EVENT_COUNT];
+    dzU64 ids[DZ_TEST_EVENT_COUNT];
+    dzU64 count;
+} dzTestEventLog;
+
+/* A structure that represents a test event. */
+typedef struct dzTestEvent_ {
+    dzTestEventLog *log;
+    dzU64 id;
+} dzTestEvent;
+
+/* Constants ==============================================================> */
+
+static const dzDieConfig dieConfig = {
+    .dieId = 0U,
+    .cellType = DZ_CELL_TYPE_MLC,
+    .badBlockRatio = 0.0,
+    .planeCountPerDie = 2U,
+    .blockCountPerPlane = 64U,
+    .pageCountPerBlock = 64U,
+    .pageSizeInBytes = DZ_TEST_PAGE_SIZE_IN_BYTES
+};
+
+/* Private Variables ======================================================> */
+
+static dzSim *sim = NULL;
+
+/* Private Function Prototypes ============================================> */
+
+static void dzTestSetupCb(void *ctx);
+static void dzTestTeardownCb(void *ctx);
+
+static void dzTestOnEvent(dzSim *sim, void *ctx);
+static void dzTestOnOpComplete(dzSim *sim, dzSimOp *op);
+
+TEST dzTestSimEventOrder(void);
+TEST dzTestSimDieOps(void);
+TEST dzTestSimDieBusy(void);
+TEST dzTestSimCacheOps(void);
+TEST dzTestSimSuspend(void);
+
+/* Public Functions =======================================================> */
+
+SUITE(dzTestSim) {
+    SET_SETUP(dzTestSetupCb, NULL);
+    SET_TEARDOWN(dzTestTeardownCb, NULL);
+
+    RUN_TEST(dzTestSimEventOrder);
+    RUN_TEST(dzTestSimDieOps);
+    RUN_TEST(dzTestSimDieBusy);
+    RUN_TEST(dzTestSimCacheOps);
+    RUN_TEST(dzTestSimSuspend);
+}
+
+/* Private Functions ======================================================> */
+
+static void dzTestSetupCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    // NOTE: A small capacity, so that the event queue has to grow
+    (void) dzSimInit(&sim, (dzSimConfig) { .eventCapacity = 16U });
+}
+
+static void dzTestTeardownCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    dzSimDeinit(sim), sim = NULL;
+}
+
+static void dzTestOnEvent(dzSim *sim, void *ctx) {
+    dzTestEvent *event = ctx;
+
+    dzTestEventLog *log = event->log;
+
+    log->times[log->count] = dzSimGetCurrentTime(sim);
+    log->ids[log->count] = event->id;
+
+    log->count++;
+}
+
+static void dzTestOnOpComplete(dzSim *sim, dzSimOp *op) {
+    DZ_API_UNUSED_VARIABLE(sim);
+
+    *((dzF64 *) op->ctx) = dzDieGetLastLatency(op->die);
+}
+
+/* ========================================================================> */
+
+TEST dzTestSimEventOrder(void) {
+    ASSERT_NEQ(NULL, sim);
+
+    static dzTestEventLog log = { .count = 0U };
+    static dzTestEvent events[DZ_TEST_EVENT_COUNT];
+
+    dzRng rng;
+
+    dzUtilsRngInit(&rng, 0x5EEDU);
+
+    for (dzU64 i = 0U; i < DZ_TEST_EVENT_COUNT; i++) {
+        events[i] = (dzTestEvent) { .log = &log, .id = i };
+
+        // NOTE: Only a few distinct times, so that many events are tied
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzSimSchedule(sim,
+                                dzUtilsRngRange(&rng, 0U, 15U),
+                                dzTestOnEvent,
+                                &events[i]));
+    }
+
+    ASSERT_EQ(DZ_TEST_EVENT_COUNT, dzSimGetPendingEventCount(sim));
+
+    dzU64 processedEventCount = dzSimRun(sim, 7U);
+
+    ASSERT_EQ(processedEventCount, log.count);
+
+    ASSERT_GTE(7U, log.times[log.count - 1U]);
+    ASSERT_EQ(log.times[log.count - 1U], dzSimGetCurrentTime(sim));
+
+    ASSERT_EQ(DZ_TEST_EVENT_COUNT - log.count, dzSimRun(sim, UINT64_MAX));
+
+    ASSERT_EQ(DZ_TEST_EVENT_COUNT, log.count);
+    ASSERT_EQ(0U, dzSimGetPendingEventCount(sim));
+    ASSERT_EQ(DZ_TEST_EVENT_COUNT, dzSimGetProcessedEventCount(sim));
+
+    for (dzU64 i = 1U; i < DZ_TEST_EVENT_COUNT; i++) {
+        ASSERT_LTE(log.times[i - 1U], log.times[i]);
+
+        // NOTE: Events at the same time are processed in FIFO order
+        if (log.times[i - 1U] == log.times[i])
+            ASSERT_LT(log.ids[i - 1U], log.ids[i]);
+    }
+
+    ASSERT_FALSE(dzSimStep(sim));
+
+    PASS();
+}
+
+TEST dzTestSimDieOps(void) {
+    ASSERT_NEQ(NULL, sim);
+
+    dzDie *die = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&die, dieConfig));
+
+    dzByte data[DZ_TEST_PAGE_SIZE_IN_BYTES] = { 0x5A };
+
+    dzByteArray buffer = { .ptr = data, .size = sizeof data };
+
+    dzPPA ppa = dzDieGetFirstPPA(die);
+
+    while (dzDieGetPageState(die, ppa) != DZ_PAGE_STATE_FREE)
+        ppa = dzDieGetNextPPA(die, ppa);
+
+    dzPBA pba = dzDieGetNextPBA(die, ppa);
+
+    // NOTE: Only fully programmed blocks can be erased at this point
+    for (pba.pageId = 0U; pba.pageId < dieConfig.pageCountPerBlock;
+         pba.pageId++)
+        ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(die, pba, buffer));
+
+    dzF64 latencies[3] = { 0.0, 0.0, 0.0 };
+
+    dzSimOp ops[3] = {
+        { .type = DZ_SIM_OP_TYPE_PROGRAM, .ppa = ppa, .buffer = buffer },
+        { .type = DZ_SIM_OP_TYPE_READ, .ppa = ppa, .buffer = buffer },
+        { .type = DZ_SIM_OP_TYPE_ERASE, .ppa = pba }
+    };
+
+    for (dzU64 i = 0U; i < 3U; i++) {
+        ops[i].die = die;
+
+        ops[i].onComplete = dzTestOnOpComplete, ops[i].ctx = &latencies[i];
+    }
+
+    // NOTE: Each operation is issued long after the previous one completes
+    for (dzU64 i = 0U; i < 3U; i++)
+        ASSERT_EQ(DZ_RESULT_OK, dzSimSubmitOp(sim, &ops[i], i * 10000000U));
+
+    ASSERT_EQ(6U, dzSimRun(sim, UINT64_MAX));
+
+    for (dzU64 i = 0U; i < 3U; i++) {
+        ASSERT_EQ(DZ_RESULT_OK, ops[i].result);
+
+        ASSERT_EQ(i * 10000000U, ops[i].startTime);
+
+        ASSERT_LT(0.0, latencies[i]);
+
+        ASSERT_EQ((dzU64) ((latencies[i] * 1e6) + 0.5),
+                  ops[i].endTime - ops[i].startTime);
+    }
+
+    dzDieDeinit(die);
+
+    PASS();
+}
+
+TEST dzTestSimDieBusy(void) {
+    ASSERT_NEQ(NULL, sim);
+
+    dzDie *die = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&die, dieConfig));
+
+    dzByte data[DZ_TEST_PAGE_SIZE_IN_BYTES] = { 0xA5 };
+
+    dzByteArray buffer = { .ptr = data, .size = sizeof data };
+
+    dzPPA ppa = dzDieGetFirstPPA(die);
+
+    while (dzDieGetPageState(die, ppa) != DZ_PAGE_STATE_FREE)
+        ppa = dzDieGetNextPPA(die, ppa);
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(die, ppa, buffer));
+
+    ASSERT(dzDieIsReady(die, 0U));
+
+    ASSERT_EQ(DZ_DIE_STATUS_WP_N | DZ_DIE_STATUS_RDY | DZ_DIE_STATUS_ARDY,
+              dzDieReadStatus(die, 0U));
+
+    dzSimOp ops[DZ_TEST_OP_COUNT];
+
+    // NOTE: All reads are issued at once, but the die can only take one
+    for (dzU64 i = 0U; i < DZ_TEST_OP_COUNT; i++) {
+        ops[i] = (dzSimOp) { .type = DZ_SIM_OP_TYPE_READ,
+                             .die = die,
+                             .ppa = ppa,
+                             .buffer = buffer };
+
+        ASSERT_EQ(DZ_RESULT_OK, dzSimSubmitOp(sim, &ops[i], 0U));
+    }
+
+    ASSERT(dzSimStep(sim));
+
+    ASSERT_FALSE(dzDieIsReady(die, dzSimGetCurrentTime(sim)));
+
+    ASSERT_EQ(DZ_DIE_STATUS_WP_N,
+              dzDieReadStatus(die, dzSimGetCurrentTime(sim)));
+
+    ASSERT_EQ(DZ_RESULT_BUSY,
+              dzDieMarkAsBusy(die, 0x01U, dzSimGetCurrentTime(sim), 1U));
+
+    (void) dzSimRun(sim, UINT64_MAX);
+
+    dzU64 busyTime = 0U;
+
+    for (dzU64 i = 0U; i < DZ_TEST_OP_COUNT; i++) {
+        ASSERT_EQ(DZ_RESULT_OK, ops[i].result);
+
+        ASSERT_EQ(0U, ops[i].issueTime);
+
+        // NOTE: Queued operations start as soon as the die becomes ready
+        if (i > 0U) ASSERT_EQ(ops[i - 1U].endTime, ops[i].startTime);
+
+        busyTime += ops[i].endTime - ops[i].startTime;
+    }
+
+    dzU64 endTime = ops[DZ_TEST_OP_COUNT - 1U].endTime;
+
+    ASSERT_EQ(endTime, dzDieGetReadyTime(die));
+    ASSERT_EQ(busyTime, dzDieGetBusyTime(die));
+
+    ASSERT_EQ(busyTime, dzDieGetPlaneBusyTime(die, ppa.planeId));
+    ASSERT_EQ(0U, dzDieGetPlaneBusyTime(die, ppa.planeId ^ 1U));
+
+    ASSERT_IN_RANGE(1.0, dzDieGetUtilization(die, endTime), 1e-9);
+    ASSERT_IN_RANGE(0.5, dzDieGetUtilization(die, 2U * endTime), 1e-9);
+
+    ASSERT(dzDieIsReady(die, endTime));
+
+    ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+              dzDieMarkAsBusy(die, 0x00U, endTime, 1U));
+    ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+              dzDieMarkAsBusy(die, 0x04U, endTime, 1U));
+
+    ASSERT_EQ(DZ_RESULT_OK, dzDieMarkAsBusy(die, 0x03U, endTime, 1U));
+
+    dzDieDeinit(die);
+
+    PASS();
+}
+
+TEST dzTestSimCacheOps(void) {
+    ASSERT_NEQ(NULL, sim);
+
+    dzDieConfig newDieConfig = dieConfig;
+
+    // NOTE: ONFI Timing Mode 5
+    newDieConfig.ioCycleTime = 20U;
+
+    // NOTE: Identical dies draw identical latencies
+    dzDie *dies[2] = { NULL, NULL };
+
+    for (dzU64 i = 0U; i < 2U; i++)
+        ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&dies[i], newDieConfig));
+
+    ASSERT_LT(0U, dzDieGetPageTransferTime(dies[0]));
+
+    dzByte data[DZ_TEST_PAGE_SIZE_IN_BYTES] = { 0xC5 };
+
+    dzByteArray buffer = { .ptr = data, .size = sizeof data };
+
+    dzPBA pba = dzDieGetNextPBA(dies[0], dzDieGetFirstPBA(dies[0]));
+
+    dzSimOp ops[2][DZ_TEST_OP_COUNT];
+
+    // NOTE: The first die runs plain operations, the second cached ones
+    for (dzU64 i = 0U; i < 2U; i++) {
+        for (dzU64 j = 0U; j < DZ_TEST_OP_COUNT; j++) {
+            ops[i][j] = (dzSimOp) {
+                .type = (i == 0U) ? DZ_SIM_OP_TYPE_PROGRAM
+                                  : DZ_SIM_OP_TYPE_CACHE_PROGRAM,
+                .die = dies[i],
+                .ppa = pba,
+                .buffer = buffer
+            };
+
+            ops[i][j].ppa.pageId = j;
+
+            ASSERT_EQ(DZ_RESULT_OK, dzSimSubmitOp(sim, &ops[i][j], 0U));
+        }
+    }
+
+    (void) dzSimRun(sim, UINT64_MAX);
+
+    for (dzU64 j = 1U; j < DZ_TEST_OP_COUNT; j++) {
+        ASSERT_EQ(DZ_RESULT_OK, ops[1][j].result);
+
+        // NOTE: The next page is loaded while the array is programming
+        ASSERT_LT(ops[1][j].startTime, dzDieGetReadyTime(dies[1]));
+    }
+
+    ASSERT_LT(dzDieGetReadyTime(dies[1]), dzDieGetReadyTime(dies[0]));
+
+    {
+        dzU64 endTime = ops[1][DZ_TEST_OP_COUNT - 1U].endTime;
+
+        // NOTE: R/B# goes high before the last page is programmed
+        ASSERT_EQ(DZ_DIE_STATUS_WP_N | DZ_DIE_STATUS_RDY,
+                  dzDieReadStatus(dies[1], endTime));
+    }
+
+    dzU64 startTime = dzSimGetCurrentTime(sim);
+
+    for (dzU64 i = 0U; i < 2U; i++) {
+        for (dzU64 j = 0U; j < DZ_TEST_OP_COUNT; j++) {
+            ops[i][j].type = (i == 0U) ? DZ_SIM_OP_TYPE_READ
+                                       : DZ_SIM_OP_TYPE_CACHE_READ;
+
+            ASSERT_EQ(DZ_RESULT_OK, dzSimSubmitOp(sim, &ops[i][j], 0U));
+        }
+    }
+
+    (void) dzSimRun(sim, UINT64_MAX);
+
+    for (dzU64 j = 1U; j < DZ_TEST_OP_COUNT; j++) {
+        ASSERT_EQ(DZ_RESULT_OK, ops[1][j].result);
+
+        // NOTE: The next page is sensed while the last one is read out
+        ASSERT_LT(ops[1][j].startTime, ops[1][j - 1U].endTime);
+        ASSERT_LTE(ops[1][j - 1U].endTime, ops[1][j].endTime);
+    }
+
+    ASSERT_LT(ops[1][DZ_TEST_OP_COUNT - 1U].endTime - startTime,
+              ops[0][DZ_TEST_OP_COUNT - 1U].endTime - startTime);
+
+    for (dzU64 i = 0U; i < 2U; i++)
+        dzDieDeinit(dies[i]);
+
+    PASS();
+}
+
+TEST dzTestSimSuspend(void) {
+    ASSERT_NEQ(NULL, sim);
+
+    dzSim *suspendSim = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK,
+              dzSimInit(&suspendSim,
+                        (dzSimConfig) { .suspendOverhead = 20000U,
+                                        .maxSuspendCount = 1U }));
+
+    // NOTE: Identical dies draw identical latencies
+    dzDie *dies[2] = { NULL, NULL };
+
+    dzSim *sims[2] = { sim, suspendSim };
+
+    dzByte data[DZ_TEST_PAGE_SIZE_IN_BYTES] = { 0x3C };
+
+    dzByteArray buffer = { .ptr = data, .size = sizeof data };
+
+    dzSimOp ops[2][3];
+
+    for (dzU64 i = 0U; i < 2U; i++) {
+        ASSERT_EQ(DZ_RESULT_OK, dzDieInit(&dies[i], dieConfig));
+
+        dzPPA ppa = dzDieGetFirstPPA(dies[i]);
+
+        while (dzDieGetPageState(dies[i], ppa) != DZ_PAGE_STATE_FREE)
+            ppa = dzDieGetNextPPA(dies[i], ppa);
+
+        ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(dies[i], ppa, buffer));
+
+        dzPBA pba = dzDieGetNextPBA(dies[i], ppa);
+
+        for (pba.pageId = 0U; pba.pageId < dieConfig.pageCountPerBlock;
+             pba.pageId++)
+            ASSERT_EQ(DZ_RESULT_OK, dzDieProgramPage(dies[i], pba, buffer));
+
+        ops[i][0] = (dzSimOp) { .type = DZ_SIM_OP_TYPE_ERASE,
+                                .die = dies[i],
+                                .ppa = pba };
+
+        ASSERT_EQ(DZ_RESULT_OK, dzSimSubmitOp(sims[i], &ops[i][0], 0U));
+
+        // NOTE: Both reads arrive long before the erase completes
+        for (dzU64 j = 1U; j < 3U; j++) {
+            ops[i][j] = (dzSimOp) { .type = DZ_SIM_OP_TYPE_READ,
+                                    .die = dies[i],
+                                    .ppa = ppa,
+                                    .buffer = buffer };
+
+            ASSERT_EQ(DZ_RESULT_OK,
+                      dzSimSubmitOp(sims[i], &ops[i][j], 100000U));
+        }
+
+        (void) dzSimRun(sims[i], UINT64_MAX);
+
+        for (dzU64 j = 0U; j < 3U; j++)
+            ASSERT_EQ(DZ_RESULT_OK, ops[i][j].result);
+
+        // NOTE: The die forgets the erase once it is completed
+        ASSERT_EQ(NULL, dzDieGetActiveOp(dies[i]));
+    }
+
+    ASSERT_EQ(0U, ops[0][0].suspendCount);
+    ASSERT_EQ(ops[0][0].endTime, ops[0][1].startTime);
+
+    // NOTE: The first read suspends the erase, instead of waiting for it
+    ASSERT_EQ(1U, ops[1][0].suspendCount);
+    ASSERT_EQ(100000U, ops[1][1].startTime);
+
+    dzU64 suspendTime = ops[1][1].endTime - ops[1][1].startTime;
+
+    ASSERT_EQ(20000U + (ops[0][1].endTime - ops[0][1].startTime),
+              suspendTime);
+
+    ASSERT_EQ(ops[0][0].endTime + suspendTime, ops[1][0].endTime);
+
+    // NOTE: The die is only kept busy longer by the suspension overhead
+    ASSERT_EQ(dzDieGetBusyTime(dies[0]) + 20000U, dzDieGetBusyTime(dies[1]));
+
+    // NOTE: The erase cannot be suspended more than once
+    ASSERT_EQ(ops[1][0].endTime, ops[1][2].startTime);
+
+    for (dzU64 i = 0U; i < 2U; i++)
+        dzDieDeinit(dies[i]);
+
+    dzSimDeinit(suspendSim);
+
+    PASS();
+}
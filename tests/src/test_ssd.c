@@ -0,0 +1,373 @@
+/*
+    Copyright (c) 2025 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a 
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation 
+    the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+    and/or sell copies of the Software, and to permit persons to whom the 
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included 
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ===============================================================> */
+
+#include "greatest.h"
+#include "ssdeez.h"
+
+/* Macros =================================================================> */
+
+// clang-format off
+
+#define DZ_TEST_CHANNEL_COUNT       2U
+#define DZ_TEST_CHIP_COUNT          2U
+#define DZ_TEST_DIE_COUNT           2U
+#define DZ_TEST_OP_COUNT_PER_DIE    4U
+#define DZ_TEST_PAGE_SIZE_IN_BYTES  2048U
+
+// clang-format on
+
+/* Constants ==============================================================> */
+
+// clang-format off
+
+static dzDieConfig dieConfig = {
+    .cellType = DZ_CELL_TYPE_TLC,
+    .badBlockRatio = 0.0,
+    .planeCountPerDie = 2U,
+    .blockCountPerPlane = 8U,
+    .pageCountPerBlock = 32U,
+    .pageSizeInBytes = DZ_TEST_PAGE_SIZE_IN_BYTES
+};
+
+static dzChipConfig chipConfig = {
+    .dieConfig = &dieConfig,
+    .seed = 0xC0FFEEU,
+    .dieCount = DZ_TEST_DIE_COUNT,
+    .threadCount = 1U
+};
+
+static dzChannelConfig channelConfig = {
+    .chipConfig = &chipConfig,
+    .chipCount = DZ_TEST_CHIP_COUNT,
+    .timingMode = 4U
+};
+
+static const dzSSDConfig ssdConfig = {
+    .channelConfig = &channelConfig,
+    .channelCount = DZ_TEST_CHANNEL_COUNT
+};
+
+// clang-format on
+
+/* Private Variables ======================================================> */
+
+static dzSSD *ssd = NULL;
+
+/* Private Function Prototypes ============================================> */
+
+static void dzTestSetupCb(void *ctx);
+static void dzTestTeardownCb(void *ctx);
+
+static void dzTestSyncCb(dzSim **sims, dzU32 simCount, dzU64 time, void *ctx);
+
+TEST dzTestSSDInit(void);
+TEST dzTestSSDAddressing(void);
+TEST dzTestSSDSubmitOp(void);
+TEST dzTestSSDRunParallel(void);
+
+/* Public Functions =======================================================> */
+
+SUITE(dzTestSSD) {
+    SET_SETUP(dzTestSetupCb, NULL);
+    SET_TEARDOWN(dzTestTeardownCb, NULL);
+
+    RUN_TEST(dzTestSSDInit);
+    RUN_TEST(dzTestSSDAddressing);
+    RUN_TEST(dzTestSSDSubmitOp);
+    RUN_TEST(dzTestSSDRunParallel);
+}
+
+/* Private Functions ======================================================> */
+
+static void dzTestSetupCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    (void) dzSSDInit(&ssd, ssdConfig);
+}
+
+static void dzTestTeardownCb(void *ctx) {
+    DZ_API_UNUSED_VARIABLE(ctx);
+
+    dzSSDDeinit(ssd), ssd = NULL;
+}
+
+static void dzTestSyncCb(dzSim **sims, dzU32 simCount, dzU64 time, void *ctx) {
+    dzU64 *syncCount = ctx;
+
+    for (dzU32 i = 0U; i < simCount; i++)
+        if (dzSimGetCurrentTime(sims[i]) < time) return;
+
+    (*syncCount)++;
+}
+
+/* ========================================================================> */
+
+TEST dzTestSSDInit(void) {
+    ASSERT_NEQ(NULL, ssd);
+
+    ASSERT_EQ(DZ_TEST_CHANNEL_COUNT, dzSSDGetChannelCount(ssd));
+
+    ASSERT_EQ(DZ_TEST_CHANNEL_COUNT * DZ_TEST_CHIP_COUNT * DZ_TEST_DIE_COUNT,
+              dzSSDGetDieCount(ssd));
+
+    dzU64 pageCount = 0U;
+
+    for (dzU64 i = 0U; i < DZ_TEST_CHANNEL_COUNT; i++) {
+        dzChannel *channel = dzSSDGetChannel(ssd, i);
+
+        for (dzU64 j = 0U; j < DZ_TEST_CHIP_COUNT; j++) {
+            dzChip *chip = dzChannelGetChip(channel, j);
+
+            for (dzU64 k = 0U; k < DZ_TEST_DIE_COUNT; k++) {
+                dzPPA ppa = { .channelId = i, .chipId = j, .dieId = k };
+
+                ASSERT_EQ(dzChipGetDie(chip, k), dzSSDGetDie(ssd, ppa));
+
+                pageCount += dzDieGetPageCount(dzSSDGetDie(ssd, ppa));
+            }
+        }
+    }
+
+    ASSERT_EQ(pageCount, dzSSDGetPageCount(ssd));
+
+    {
+        dzPPA ppa = { .channelId = DZ_TEST_CHANNEL_COUNT };
+
+        ASSERT_EQ(NULL, dzSSDGetDie(ssd, ppa));
+
+        ppa = (dzPPA) { .chipId = DZ_TEST_CHIP_COUNT };
+
+        ASSERT_EQ(NULL, dzSSDGetDie(ssd, ppa));
+
+        ppa = (dzPPA) { .dieId = DZ_TEST_DIE_COUNT };
+
+        ASSERT_EQ(NULL, dzSSDGetDie(ssd, ppa));
+    }
+
+    PASS();
+}
+
+TEST dzTestSSDAddressing(void) {
+    ASSERT_NEQ(NULL, ssd);
+
+    dzByte data[DZ_TEST_PAGE_SIZE_IN_BYTES] = { 0x77 };
+
+    dzByteArray buffer = { .ptr = data, .size = sizeof data };
+
+    dzU64 pageCount = 0U, dieCount = 0U;
+
+    dzDie *lastDie = NULL;
+
+    for (dzPPA ppa = dzSSDGetFirstPPA(ssd); ppa.pageId != DZ_PAGE_INVALID_ID;
+         ppa = dzSSDGetNextPPA(ssd, ppa)) {
+        dzDie *die = dzSSDGetDie(ssd, ppa);
+
+        ASSERT_NEQ(NULL, die);
+
+        pageCount++;
+
+        if (die == lastDie) continue;
+
+        // NOTE: Program the first page of every die through the drive
+        ASSERT_EQ(DZ_RESULT_OK, dzSSDProgramPage(ssd, ppa, buffer));
+
+        lastDie = die, dieCount++;
+    }
+
+    ASSERT_EQ(dzSSDGetDieCount(ssd), dieCount);
+
+    // NOTE: The first block of each die is reserved
+    ASSERT_EQ(dzSSDGetPageCount(ssd)
+                  - (dieCount * dieConfig.pageCountPerBlock),
+              pageCount);
+
+    ASSERT_EQ(dieCount, dzSSDGetTotalProgramCount(ssd));
+    ASSERT_EQ(dieCount, dzSSDGetValidPageCount(ssd));
+
+    PASS();
+}
+
+TEST dzTestSSDSubmitOp(void) {
+    ASSERT_NEQ(NULL, ssd);
+
+    dzSim *sim = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzSimInit(&sim, (dzSimConfig) { 0 }));
+
+    dzByte data[DZ_TEST_PAGE_SIZE_IN_BYTES] = { 0x99 };
+
+    dzByteArray buffer = { .ptr = data, .size = sizeof data };
+
+    dzSimOp ops[DZ_TEST_CHANNEL_COUNT * DZ_TEST_CHIP_COUNT
+                * DZ_TEST_DIE_COUNT];
+
+    dzU64 opCount = 0U;
+
+    for (dzPPA ppa = dzSSDGetFirstPPA(ssd); ppa.pageId != DZ_PAGE_INVALID_ID;
+         ppa = dzSSDGetNextPPA(ssd, ppa)) {
+        if (opCount > 0U
+            && dzSSDGetDie(ssd, ppa) == dzSSDGetDie(ssd, ops[opCount - 1].ppa))
+            continue;
+
+        ops[opCount] = (dzSimOp) { .type = DZ_SIM_OP_TYPE_PROGRAM,
+                                   .ppa = ppa,
+                                   .buffer = buffer };
+
+        ASSERT_EQ(DZ_RESULT_OK, dzSSDSubmitOp(ssd, sim, &ops[opCount], 0U));
+
+        ASSERT_EQ(dzSSDGetDie(ssd, ppa), ops[opCount].die);
+        ASSERT_EQ(dzSSDGetChannel(ssd, ppa.channelId), ops[opCount].channel);
+
+        opCount++;
+    }
+
+    {
+        dzPPA ppas[2] = { ops[0].ppa, ops[1].ppa };
+
+        dzSimOp op = { .type = DZ_SIM_OP_TYPE_READ,
+                       .ppas = ppas,
+                       .ppaCount = 2U };
+
+        // NOTE: Multi-plane operations cannot span multiple dies
+        ASSERT_EQ(DZ_RESULT_INVALID_ARGUMENT,
+                  dzSSDSubmitOp(ssd, sim, &op, 0U));
+    }
+
+    (void) dzSimRun(sim, UINT64_MAX);
+
+    for (dzU64 i = 0U; i < opCount; i++)
+        ASSERT_EQ(DZ_RESULT_OK, ops[i].result);
+
+    dzU64 transferTime = dzDieGetPageTransferTime(ops[0].die);
+
+    // NOTE: Channels have their own buses
+    for (dzU64 i = 0U; i < DZ_TEST_CHANNEL_COUNT; i++)
+        ASSERT_EQ(DZ_TEST_CHIP_COUNT * DZ_TEST_DIE_COUNT * transferTime,
+                  dzChannelGetBusBusyTime(dzSSDGetChannel(ssd, i)));
+
+    dzSimDeinit(sim);
+
+    PASS();
+}
+
+TEST dzTestSSDRunParallel(void) {
+    ASSERT_NEQ(NULL, ssd);
+
+    dzSSD *parallelSSD = NULL;
+
+    ASSERT_EQ(DZ_RESULT_OK, dzSSDInit(&parallelSSD, ssdConfig));
+
+    ASSERT_LT(0U, dzSSDGetLookahead(parallelSSD));
+
+    dzSim *sim = NULL, *sims[DZ_TEST_CHANNEL_COUNT] = { NULL };
+
+    ASSERT_EQ(DZ_RESULT_OK, dzSimInit(&sim, (dzSimConfig) { 0 }));
+
+    for (dzU64 i = 0U; i < DZ_TEST_CHANNEL_COUNT; i++)
+        ASSERT_EQ(DZ_RESULT_OK, dzSimInit(&sims[i], (dzSimConfig) { 0 }));
+
+    dzByte data[DZ_TEST_PAGE_SIZE_IN_BYTES] = { 0x55 };
+
+    dzByteArray buffer = { .ptr = data, .size = sizeof data };
+
+    enum {
+        DZ_TEST_OP_COUNT = DZ_TEST_CHANNEL_COUNT * DZ_TEST_CHIP_COUNT
+                           * DZ_TEST_DIE_COUNT * DZ_TEST_OP_COUNT_PER_DIE
+    };
+
+    dzSimOp ops[DZ_TEST_OP_COUNT], parallelOps[DZ_TEST_OP_COUNT];
+
+    dzU64 opCount = 0U, opCountPerDie = 0U;
+
+    dzDie *lastDie = NULL;
+
+    for (dzPPA ppa = dzSSDGetFirstPPA(ssd); ppa.pageId != DZ_PAGE_INVALID_ID;
+         ppa = dzSSDGetNextPPA(ssd, ppa)) {
+        dzDie *die = dzSSDGetDie(ssd, ppa);
+
+        if (die != lastDie) lastDie = die, opCountPerDie = 0U;
+
+        if (opCountPerDie >= DZ_TEST_OP_COUNT_PER_DIE) continue;
+
+        ops[opCount] = (dzSimOp) { .type = DZ_SIM_OP_TYPE_PROGRAM,
+                                   .ppa = ppa,
+                                   .buffer = buffer };
+
+        parallelOps[opCount] = ops[opCount];
+
+        // NOTE: Each channel is simulated by its own simulator
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzSSDSubmitOp(ssd, sim, &ops[opCount], 0U));
+        ASSERT_EQ(DZ_RESULT_OK,
+                  dzSSDSubmitOp(parallelSSD,
+                                sims[ppa.channelId],
+                                &parallelOps[opCount],
+                                0U));
+
+        opCount++, opCountPerDie++;
+    }
+
+    ASSERT_EQ(DZ_TEST_OP_COUNT, opCount);
+
+    dzU64 eventCount = dzSimRun(sim, UINT64_MAX), syncCount = 0U;
+
+    dzSimParallelConfig config = { .lookahead = dzSSDGetLookahead(
+                                       parallelSSD),
+                                   .threadCount = DZ_TEST_CHANNEL_COUNT,
+                                   .onSync = dzTestSyncCb,
+                                   .ctx = &syncCount };
+
+    ASSERT_EQ(eventCount,
+              dzSimRunParallel(sims,
+                               DZ_TEST_CHANNEL_COUNT,
+                               UINT64_MAX,
+                               config));
+
+    ASSERT_LT(0U, syncCount);
+
+    // NOTE: The parallel run must match the sequential run exactly
+    for (dzU64 i = 0U; i < opCount; i++) {
+        ASSERT_EQ(DZ_RESULT_OK, ops[i].result);
+        ASSERT_EQ(ops[i].result, parallelOps[i].result);
+
+        ASSERT_EQ(ops[i].startTime, parallelOps[i].startTime);
+        ASSERT_EQ(ops[i].endTime, parallelOps[i].endTime);
+    }
+
+    ASSERT_EQ(dzSSDGetTotalProgramCount(ssd),
+              dzSSDGetTotalProgramCount(parallelSSD));
+
+    for (dzU64 i = 0U; i < DZ_TEST_CHANNEL_COUNT; i++)
+        ASSERT_EQ(dzChannelGetBusBusyTime(dzSSDGetChannel(ssd, i)),
+                  dzChannelGetBusBusyTime(dzSSDGetChannel(parallelSSD, i)));
+
+    for (dzU64 i = 0U; i < DZ_TEST_CHANNEL_COUNT; i++)
+        dzSimDeinit(sims[i]);
+
+    dzSimDeinit(sim);
+
+    dzSSDDeinit(parallelSSD);
+
+    PASS();
+}
@@ -22,6 +22,8 @@
 
 /* Includes ===============================================================> */
 
+#include <pthread.h>
+
 #include "greatest.h"
 #include "ssdeez.h"
 
@@ -36,18 +38,76 @@
 
 /* Private Function Prototypes ============================================> */
 
+static void *dzTestDrawDefaultRng(void *ctx);
+
+TEST dzTestBitmap(void);
 TEST dzTestGaussian(void);
+TEST dzTestGaussianFill(void);
 TEST dzTestRandRange(void);
+TEST dzTestRngStreams(void);
 
 /* Public Functions =======================================================> */
 
 SUITE(dzTestUtils) {
+    RUN_TEST(dzTestBitmap);
     RUN_TEST(dzTestGaussian);
+    RUN_TEST(dzTestGaussianFill);
     RUN_TEST(dzTestRandRange);
+    RUN_TEST(dzTestRngStreams);
 }
 
 /* Private Functions ======================================================> */
 
+static void *dzTestDrawDefaultRng(void *ctx) {
+    *((dzU64 *) ctx) = dzUtilsRngNext(NULL);
+
+    return NULL;
+}
+
+TEST dzTestBitmap(void) {
+    dzU64 bitmap[3];
+
+    const dzU64 bitCount = 160U;
+
+    ASSERT_EQ(3U, dzUtilsBitmapGetWordCount(bitCount));
+
+    {
+        dzUtilsBitmapFill(bitmap, bitCount, true);
+
+        ASSERT_EQ(bitCount, dzUtilsBitmapCount(bitmap, bitCount));
+
+        // NOTE: Padding bits should never be set
+        ASSERT_EQ((UINT64_C(1) << 32) - 1U, bitmap[2]);
+
+        dzUtilsBitmapFill(bitmap, bitCount, false);
+
+        ASSERT_EQ(0U, dzUtilsBitmapCount(bitmap, bitCount));
+        ASSERT_EQ(UINT64_MAX, dzUtilsBitmapFindNext(bitmap, bitCount, 0U));
+    }
+
+    {
+        dzUtilsBitmapSet(bitmap, 3U);
+        dzUtilsBitmapSet(bitmap, 64U);
+        dzUtilsBitmapSet(bitmap, 159U);
+
+        ASSERT(dzUtilsBitmapTest(bitmap, 64U));
+        ASSERT_FALSE(dzUtilsBitmapTest(bitmap, 65U));
+
+        ASSERT_EQ(3U, dzUtilsBitmapCount(bitmap, bitCount));
+
+        ASSERT_EQ(3U, dzUtilsBitmapFindNext(bitmap, bitCount, 0U));
+        ASSERT_EQ(64U, dzUtilsBitmapFindNext(bitmap, bitCount, 4U));
+        ASSERT_EQ(159U, dzUtilsBitmapFindNext(bitmap, bitCount, 65U));
+        ASSERT_EQ(UINT64_MAX, dzUtilsBitmapFindNext(bitmap, bitCount, 160U));
+
+        dzUtilsBitmapClear(bitmap, 64U);
+
+        ASSERT_EQ(159U, dzUtilsBitmapFindNext(bitmap, bitCount, 4U));
+    }
+
+    PASS();
+}
+
 TEST dzTestGaussian(void) {
     dzF64 samples[DZ_TEST_GAUSSIAN_ITERATION_COUNT], sampleMean = 0.0;
 
@@ -87,6 +147,34 @@ TEST dzTestGaussian(void) {
     PASS();
 }
 
+TEST dzTestGaussianFill(void) {
+    dzF64 samples[DZ_TEST_GAUSSIAN_ITERATION_COUNT], sampleMean = 0.0;
+
+    dzRng rngs[2];
+
+    for (int i = 0; i < 2; i++)
+        dzUtilsRngInit(&rngs[i], 0x5EEDU);
+
+    dzUtilsRngGaussianFill(&rngs[0],
+                           samples,
+                           DZ_TEST_GAUSSIAN_ITERATION_COUNT,
+                           100.0,
+                           10.0);
+
+    // NOTE: A batch must be identical to the same number of single draws
+    for (int i = 0; i < DZ_TEST_GAUSSIAN_ITERATION_COUNT; i++) {
+        ASSERT_EQ(dzUtilsRngGaussian(&rngs[1], 100.0, 10.0), samples[i]);
+
+        sampleMean += samples[i];
+    }
+
+    sampleMean /= DZ_TEST_GAUSSIAN_ITERATION_COUNT;
+
+    ASSERT_IN_RANGE(100.0, sampleMean, 1.0);
+
+    PASS();
+}
+
 TEST dzTestRandRange(void) {
     ASSERT_EQ(dzUtilsRandRange(0U, 0U), 0U);
     ASSERT_EQ(dzUtilsRandRange(UINT64_MAX, UINT64_MAX), UINT64_MAX);
@@ -103,3 +191,51 @@ TEST dzTestRandRange(void) {
 
     PASS();
 }
+
+TEST dzTestRngStreams(void) {
+    dzRng rngs[2];
+
+    for (int i = 0; i < 2; i++)
+        dzUtilsRngInit(&rngs[i], 0x5EEDU);
+
+    ASSERT_EQ(dzUtilsRngNext(&rngs[0]), dzUtilsRngNext(&rngs[1]));
+
+    {
+        dzUtilsRngJump(&rngs[1]);
+
+        ASSERT_NEQ(dzUtilsRngNext(&rngs[0]), dzUtilsRngNext(&rngs[1]));
+
+        dzUtilsRngJump(&rngs[0]);
+
+        // NOTE: Jumping commutes with drawing values from the generator
+        ASSERT_EQ(dzUtilsRngNext(&rngs[0]), dzUtilsRngNext(&rngs[1]));
+    }
+
+    {
+        dzRng rng = rngs[0];
+
+        dzUtilsRngLongJump(&rngs[0]);
+
+        ASSERT_NEQ(dzUtilsRngNext(&rng), dzUtilsRngNext(&rngs[0]));
+    }
+
+    {
+        pthread_t threads[2];
+        dzU64 values[2];
+
+        for (int i = 0; i < 2; i++)
+            ASSERT_EQ(0,
+                      pthread_create(&threads[i],
+                                     NULL,
+                                     dzTestDrawDefaultRng,
+                                     &values[i]));
+
+        for (int i = 0; i < 2; i++)
+            ASSERT_EQ(0, pthread_join(threads[i], NULL));
+
+        // NOTE: The default generators of different threads never overlap
+        ASSERT_NEQ(values[0], values[1]);
+    }
+
+    PASS();
+}